@@ -2,4 +2,5 @@
 #define S21_CONTAINERS_ADAPTOR_CONTAINER_H
 #include "Stack_dir/s21_stack.h"
 #include "queue_dir/s21_queue.h"
+#include "spsc_queue_dir/s21_spsc_queue.h"
 #endif  // end S21_CONTAINERS_ADAPTOR_CONTAINER_H
\ No newline at end of file
@@ -0,0 +1,233 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Ограниченная очередь без блокировок для одного производителя и одного
+// потребителя. Элементы лежат в кольцевом буфере на Capacity мест, head и
+// tail - счетчики, которые только растут. Каждый счетчик пишет только
+// один поток и публикует его с release, другой читает с acquire. Счетчики
+// разнесены по разным кэш-линиям, а каждый поток держит копию чужого
+// счетчика и перечитывает его, только когда очередь кажется пустой или
+// полной
+template <class T, size_t Capacity>
+class spsc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  spsc_queue();
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue();
+
+  /*
+    Методы производителя
+  */
+
+  // Эти методы кладут элемент в конец и возвращают false, если места нет
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <class... Args>
+  bool try_emplace(Args&&... args);
+  // Этот метод копирует в очередь сколько поместится из n элементов,
+  // начиная с first, и возвращает их количество. Конец публикуется один
+  // раз на всю пачку
+  size_type push_n(const T* first, size_type n);
+
+  /*
+    Методы потребителя
+  */
+
+  // Этот метод перемещает первый элемент в out и возвращает false, если
+  // очередь пуста
+  bool try_pop(reference out);
+  // Этот метод перемещает в out до n первых элементов и возвращает их
+  // количество
+  size_type pop_n(T* out, size_type n);
+
+  /*
+    Информация о наполнении. Пока другой поток работает, это только
+    оценка
+  */
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  static constexpr size_type capacity() noexcept { return Capacity; }
+
+ private:
+  // Размер кэш-линии. std::hardware_destructive_interference_size есть не
+  // во всех стандартных библиотеках
+  static constexpr size_type kCacheLine = 64;
+
+  // Принадлежит потребителю: head и его копия tail
+  alignas(kCacheLine) std::atomic<size_type> __head;
+  size_type __tail_cache;
+  // Принадлежит производителю: tail и его копия head
+  alignas(kCacheLine) std::atomic<size_type> __tail;
+  size_type __head_cache;
+  alignas(kCacheLine) T* __buffer;
+
+  T* __slot(size_type index) const noexcept {
+    return __buffer + (index & (Capacity - 1));
+  }
+  // Этот метод возвращает, сколько мест свободно для производителя, и
+  // перечитывает head, если их меньше need
+  size_type __free(size_type tail, size_type need) noexcept;
+  // Этот метод возвращает, сколько элементов доступно потребителю, и
+  // перечитывает tail, если их меньше need
+  size_type __ready(size_type head, size_type need) noexcept;
+};
+}  // namespace s21
+
+/*
+  КОНСТРУКТОР И ДЕСТРУКТОР
+*/
+
+template <class T, size_t Capacity>
+s21::spsc_queue<T, Capacity>::spsc_queue()
+    : __head{0},
+      __tail_cache{0},
+      __tail{0},
+      __head_cache{0},
+      __buffer{std::allocator<T>().allocate(Capacity)} {}
+
+template <class T, size_t Capacity>
+s21::spsc_queue<T, Capacity>::~spsc_queue() {
+  size_type tail = __tail.load(std::memory_order_acquire);
+  for (size_type i = __head.load(std::memory_order_relaxed); i != tail; ++i)
+    __slot(i)->~value_type();
+  std::allocator<T>().deallocate(__buffer, Capacity);
+}
+
+/*
+  МЕТОДЫ ПРОИЗВОДИТЕЛЯ
+*/
+
+template <class T, size_t Capacity>
+bool s21::spsc_queue<T, Capacity>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <class T, size_t Capacity>
+bool s21::spsc_queue<T, Capacity>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <class T, size_t Capacity>
+template <class... Args>
+bool s21::spsc_queue<T, Capacity>::try_emplace(Args&&... args) {
+  size_type tail = __tail.load(std::memory_order_relaxed);
+  bool pushed = __free(tail, 1) != 0;
+  if (pushed) {
+    new (__slot(tail)) value_type(std::forward<Args>(args)...);
+    __tail.store(tail + 1, std::memory_order_release);
+  }
+  return pushed;
+}
+
+template <class T, size_t Capacity>
+size_t s21::spsc_queue<T, Capacity>::push_n(const T* first, size_type n) {
+  size_type tail = __tail.load(std::memory_order_relaxed);
+  size_type count = std::min(n, __free(tail, n));
+  // Свободные места - это не больше двух непрерывных кусков буфера
+  size_type offset = tail & (Capacity - 1);
+  size_type part = std::min(count, Capacity - offset);
+  std::uninitialized_copy_n(first, part, __buffer + offset);
+  try {
+    std::uninitialized_copy_n(first + part, count - part, __buffer);
+  } catch (...) {
+    std::destroy_n(__buffer + offset, part);
+    throw;
+  }
+  if (count != 0) __tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+/*
+  МЕТОДЫ ПОТРЕБИТЕЛЯ
+*/
+
+template <class T, size_t Capacity>
+bool s21::spsc_queue<T, Capacity>::try_pop(reference out) {
+  size_type head = __head.load(std::memory_order_relaxed);
+  bool popped = __ready(head, 1) != 0;
+  if (popped) {
+    T* place = __slot(head);
+    out = std::move(*place);
+    place->~value_type();
+    __head.store(head + 1, std::memory_order_release);
+  }
+  return popped;
+}
+
+template <class T, size_t Capacity>
+size_t s21::spsc_queue<T, Capacity>::pop_n(T* out, size_type n) {
+  size_type head = __head.load(std::memory_order_relaxed);
+  size_type count = std::min(n, __ready(head, n));
+  size_type offset = head & (Capacity - 1);
+  size_type part = std::min(count, Capacity - offset);
+  std::move(__buffer + offset, __buffer + offset + part, out);
+  std::move(__buffer, __buffer + count - part, out + part);
+  std::destroy_n(__buffer + offset, part);
+  std::destroy_n(__buffer, count - part);
+  if (count != 0) __head.store(head + count, std::memory_order_release);
+  return count;
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <class T, size_t Capacity>
+bool s21::spsc_queue<T, Capacity>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class T, size_t Capacity>
+size_t s21::spsc_queue<T, Capacity>::size() const noexcept {
+  size_type head = __head.load(std::memory_order_acquire);
+  size_type tail = __tail.load(std::memory_order_acquire);
+  // Между чтениями потребитель мог обогнать прочитанный tail
+  return tail > head ? tail - head : 0;
+}
+
+/*
+  ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
+*/
+
+template <class T, size_t Capacity>
+size_t s21::spsc_queue<T, Capacity>::__free(size_type tail,
+                                            size_type need) noexcept {
+  size_type free = Capacity - (tail - __head_cache);
+  if (free < need) {
+    __head_cache = __head.load(std::memory_order_acquire);
+    free = Capacity - (tail - __head_cache);
+  }
+  return free;
+}
+
+template <class T, size_t Capacity>
+size_t s21::spsc_queue<T, Capacity>::__ready(size_type head,
+                                             size_type need) noexcept {
+  size_type ready = __tail_cache - head;
+  if (ready < need) {
+    __tail_cache = __tail.load(std::memory_order_acquire);
+    ready = __tail_cache - head;
+  }
+  return ready;
+}
+
+#endif  // S21_SPSC_QUEUE_H
@@ -1,4 +1,5 @@
 #ifndef S21_CONTAINERS_ADDITIONAL_CONTAINER_H
 #define S21_CONTAINERS_ADDITIONAL_CONTAINER_H
 #include "array_dir/s21_array.h"
+#include "span_dir/s21_span.h"
 #endif  // end S21_CONTAINERS_ADDITIONAL_CONTAINER_H
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef S21_SPAN_H
+#define S21_SPAN_H
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+namespace s21 {
+// Невладеющий вид на непрерывный участок памяти: указатель и длина
+template <typename T>
+class span {
+ public:
+  /*_________Span Member type________________*/
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+
+ public:
+  /*________Span Member functions__________*/
+  span() = default;
+  span(T *data, size_type size) : data_(data), size_(size) {}
+  // span<T> приводится к span<const T>
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  span(const span<U> &other) : data_(other.data()), size_(other.size()) {}
+  // Вид на весь контейнер с методами data() и size()
+  template <typename Container,
+            typename = decltype(std::declval<Container &>().data())>
+  span(Container &container)
+      : data_(container.data()), size_(container.size()) {}
+
+  /*__________Span Element access__________*/
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("pos out of range");
+    }
+    return data_[pos];
+  }
+  reference operator[](size_type pos) const { return data_[pos]; }
+  reference front() const { return data_[0]; }
+  reference back() const { return data_[size_ - 1]; }
+  T *data() const { return data_; }
+  iterator begin() const { return data_; }
+  iterator end() const { return data_ + size_; }
+
+  /*_________Span Capacity________________*/
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type size_bytes() const { return size_ * sizeof(T); }
+
+  /*________Span Subviews________________*/
+  span first(size_type count) const { return span(data_, count); }
+  span last(size_type count) const {
+    return span(data_ + size_ - count, count);
+  }
+  span subspan(size_type offset, size_type count) const {
+    return span(data_ + offset, count);
+  }
+};
+}  // namespace s21
+#endif  // END S21_SPAN_H
@@ -0,0 +1,5 @@
+#ifndef S21_CONTAINERS_ALGORITHM_H
+#define S21_CONTAINERS_ALGORITHM_H
+#include "parallel_dir/s21_parallel.h"
+#include "simd_dir/s21_simd.h"
+#endif  // end S21_CONTAINERS_ALGORITHM_H
@@ -0,0 +1,336 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.h"
+
+namespace s21 {
+namespace parallel {
+// Параллельные алгоритмы над диапазонами с произвольным доступом:
+// s21::vector, s21::array и любыми другими непрерывными контейнерами.
+// Диапазон делится на куски не меньше grain элементов, куски выполняются
+// в default_pool(). Маленький grain дает больше задач и лучше балансирует
+// нагрузку, большой - меньше накладных расходов
+
+inline constexpr size_t kDefaultGrain = size_t{1} << 14;
+
+// Проверяет, что у Range есть begin() и end()
+template <class Range, class = void>
+struct is_range : std::false_type {};
+
+template <class Range>
+struct is_range<Range, std::void_t<decltype(std::declval<Range&>().begin()),
+                                   decltype(std::declval<Range&>().end())>>
+    : std::true_type {};
+
+template <class Range>
+using enable_if_range = std::enable_if_t<is_range<Range>::value>;
+
+// Этот метод вызывает f(begin, end, chunk) для кусков [0, n) параллельно и
+// ждет их завершения. Возвращает количество кусков
+template <class Func>
+size_t for_chunks(size_t n, size_t chunks, Func f) {
+  task_group group;
+  for (size_t c = 0; c < chunks; ++c) {
+    size_t begin = n * c / chunks, end = n * (c + 1) / chunks;
+    group.run([=]() { f(begin, end, c); });
+  }
+  group.wait();
+  return chunks;
+}
+
+// Этот метод возвращает количество кусков для n элементов
+inline size_t chunk_count(size_t n, size_t grain) {
+  grain = std::max<size_t>(grain, 1);
+  return std::max<size_t>((n + grain - 1) / grain, 1);
+}
+
+namespace detail {
+// Память под n элементов без конструкторов. Элементы переносятся сюда
+// кусками параллельно и уничтожаются в деструкторе
+template <class T>
+class scratch {
+ public:
+  explicit scratch(size_t n)
+      : __data(std::allocator<T>().allocate(n)), __size(0), __capacity(n) {}
+  scratch(const scratch&) = delete;
+  scratch& operator=(const scratch&) = delete;
+  ~scratch() {
+    std::destroy(__data, __data + __size);
+    std::allocator<T>().deallocate(__data, __capacity);
+  }
+
+  // Переносит [first, first + capacity) сюда, разбивая работу на chunks
+  template <class It>
+  void move_from(It first, size_t chunks) {
+    for_chunks(__capacity, chunks, [=](size_t b, size_t e, size_t) {
+      std::uninitialized_move(first + b, first + e, __data + b);
+    });
+    __size = __capacity;
+  }
+
+  T* data() noexcept { return __data; }
+
+ private:
+  T* __data;
+  size_t __size, __capacity;
+};
+
+// Сливает соседние пары отсортированных кусков из src в dst. Кусок без
+// пары просто переносится
+template <class Src, class Dst, class Compare>
+void merge_round(Src src, Dst dst, const std::vector<size_t>& bounds,
+                 size_t width, Compare comp) {
+  size_t chunks = bounds.size() - 1;
+  task_group group;
+  for (size_t i = 0; i < chunks; i += 2 * width) {
+    size_t begin = bounds[i], middle = bounds[std::min(i + width, chunks)],
+           end = bounds[std::min(i + 2 * width, chunks)];
+    group.run([=]() {
+      std::merge(std::make_move_iterator(src + begin),
+                 std::make_move_iterator(src + middle),
+                 std::make_move_iterator(src + middle),
+                 std::make_move_iterator(src + end), dst + begin, comp);
+    });
+  }
+  group.wait();
+}
+
+// Сортирует куски по отдельности, а потом сливает их попарно по уровням
+template <class It, class Compare, class ChunkSort>
+void merge_sort(It first, It last, Compare comp, size_t grain,
+                ChunkSort chunk_sort) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  size_t n = last - first;
+  // Слияния на верхних уровнях идут в меньшее число потоков, поэтому
+  // кусков берется не больше, чем нужно для загрузки всех ядер
+  size_t chunks = std::min(chunk_count(n, grain),
+                           size_t{4} * (default_pool().size() + 1));
+  std::vector<size_t> bounds(chunks + 1);
+  for (size_t c = 0; c <= chunks; ++c) bounds[c] = n * c / chunks;
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t) {
+    chunk_sort(first + b, first + e, comp);
+  });
+  if (chunks > 1) {
+    scratch<value_type> buffer(n);
+    buffer.move_from(first, chunks);
+    bool in_buffer = true;
+    for (size_t width = 1; width < chunks; width *= 2) {
+      if (in_buffer)
+        merge_round(buffer.data(), first, bounds, width, comp);
+      else
+        merge_round(first, buffer.data(), bounds, width, comp);
+      in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+      value_type* data = buffer.data();
+      for_chunks(n, chunks, [=](size_t b, size_t e, size_t) {
+        std::move(data + b, data + e, first + b);
+      });
+    }
+  }
+}
+}  // namespace detail
+
+/*
+  ОБХОД И ПРЕОБРАЗОВАНИЕ
+*/
+
+// Этот метод вызывает f для каждого элемента
+template <class It, class Func>
+void for_each(It first, It last, Func f, size_t grain = kDefaultGrain) {
+  size_t n = last - first;
+  for_chunks(n, chunk_count(n, grain), [=](size_t b, size_t e, size_t) {
+    std::for_each(first + b, first + e, f);
+  });
+}
+
+// Этот метод записывает op(*it) в d_first и возвращает конец результата
+template <class It, class OutIt, class UnaryOp>
+OutIt transform(It first, It last, OutIt d_first, UnaryOp op,
+                size_t grain = kDefaultGrain) {
+  size_t n = last - first;
+  for_chunks(n, chunk_count(n, grain), [=](size_t b, size_t e, size_t) {
+    std::transform(first + b, first + e, d_first + b, op);
+  });
+  return d_first + n;
+}
+
+/*
+  СВЕРТКИ
+*/
+
+// Этот метод сворачивает диапазон операцией op. Куски сворачиваются
+// параллельно, а их результаты - по порядку, поэтому op должна быть
+// ассоциативной, но может быть некоммутативной
+template <class It, class T, class BinaryOp>
+T reduce(It first, It last, T init, BinaryOp op,
+         size_t grain = kDefaultGrain) {
+  size_t n = last - first;
+  if (n == 0) return init;
+  size_t chunks = chunk_count(n, grain);
+  std::vector<T> partial(chunks);
+  T* result = partial.data();
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t c) {
+    result[c] = std::accumulate(first + b + 1, first + e, T(first[b]), op);
+  });
+  return std::accumulate(partial.begin(), partial.end(), std::move(init), op);
+}
+
+template <class It, class T>
+T reduce(It first, It last, T init) {
+  return parallel::reduce(first, last, std::move(init), std::plus<>());
+}
+
+template <class It>
+typename std::iterator_traits<It>::value_type reduce(It first, It last) {
+  return parallel::reduce(first, last,
+                          typename std::iterator_traits<It>::value_type{});
+}
+
+// Этот метод записывает в d_first префиксные свертки. Первый проход
+// сворачивает куски, второй пересчитывает их, начиная с суммы предыдущих
+template <class It, class OutIt, class BinaryOp = std::plus<>>
+OutIt inclusive_scan(It first, It last, OutIt d_first, BinaryOp op = {},
+                     size_t grain = kDefaultGrain) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  size_t n = last - first;
+  if (n == 0) return d_first;
+  size_t chunks = chunk_count(n, grain);
+  std::vector<value_type> sums(chunks);
+  value_type* sum = sums.data();
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t c) {
+    sum[c] = std::accumulate(first + b + 1, first + e, value_type(first[b]),
+                             op);
+  });
+  for (size_t c = 1; c < chunks; ++c) sum[c] = op(sum[c - 1], sum[c]);
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t c) {
+    value_type acc = c == 0 ? value_type(first[b]) : op(sum[c - 1], first[b]);
+    d_first[b] = acc;
+    for (size_t i = b + 1; i < e; ++i) {
+      acc = op(std::move(acc), first[i]);
+      d_first[i] = acc;
+    }
+  });
+  return d_first + n;
+}
+
+/*
+  СОРТИРОВКА И РАЗБИЕНИЕ
+*/
+
+// Этот метод сортирует диапазон: куски сортируются std::sort, затем
+// сливаются попарно
+template <class It, class Compare = std::less<>>
+void sort(It first, It last, Compare comp = {}, size_t grain = kDefaultGrain) {
+  detail::merge_sort(first, last, comp, grain, [](It b, It e, Compare c) {
+    std::sort(b, e, c);
+  });
+}
+
+// Этот метод сортирует диапазон, сохраняя порядок равных элементов
+template <class It, class Compare = std::less<>>
+void stable_sort(It first, It last, Compare comp = {},
+                 size_t grain = kDefaultGrain) {
+  detail::merge_sort(first, last, comp, grain, [](It b, It e, Compare c) {
+    std::stable_sort(b, e, c);
+  });
+}
+
+// Этот метод переставляет элементы, для которых pred истинен, в начало и
+// возвращает конец этой части. Порядок внутри частей сохраняется. Первый
+// проход считает подходящие элементы в каждом куске, второй раскладывает
+// их на свои места, поэтому pred вызывается для каждого элемента дважды
+template <class It, class Predicate>
+It partition(It first, It last, Predicate pred, size_t grain = kDefaultGrain) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  size_t n = last - first;
+  if (n == 0) return first;
+  size_t chunks = chunk_count(n, grain);
+  std::vector<size_t> matched(chunks + 1, 0);
+  size_t* count = matched.data() + 1;
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t c) {
+    count[c] = std::count_if(first + b, first + e, pred);
+  });
+  // matched[c] - сколько подходящих элементов в кусках до c
+  std::partial_sum(matched.begin(), matched.end(), matched.begin());
+  size_t total = matched[chunks];
+  const size_t* before = matched.data();
+  detail::scratch<value_type> buffer(n);
+  buffer.move_from(first, chunks);
+  value_type* data = buffer.data();
+  for_chunks(n, chunks, [=](size_t b, size_t e, size_t c) {
+    // Неподходящие элементы кусков до c занимают b - before[c] мест
+    It yes = first + before[c];
+    It no = first + total + (b - before[c]);
+    for (size_t i = b; i < e; ++i) {
+      if (pred(data[i]))
+        *yes++ = std::move(data[i]);
+      else
+        *no++ = std::move(data[i]);
+    }
+  });
+  return first + total;
+}
+
+/*
+  ПЕРЕГРУЗКИ ДЛЯ КОНТЕЙНЕРОВ
+*/
+
+template <class Range, class Func, class = enable_if_range<Range>>
+void for_each(Range& range, Func f, size_t grain = kDefaultGrain) {
+  parallel::for_each(range.begin(), range.end(), f, grain);
+}
+
+template <class Range, class OutIt, class UnaryOp,
+          class = enable_if_range<Range>>
+OutIt transform(Range& range, OutIt d_first, UnaryOp op,
+                size_t grain = kDefaultGrain) {
+  return parallel::transform(range.begin(), range.end(), d_first, op, grain);
+}
+
+template <class Range, class T, class BinaryOp = std::plus<>,
+          class = enable_if_range<Range>>
+T reduce(Range& range, T init, BinaryOp op = {}, size_t grain = kDefaultGrain) {
+  return parallel::reduce(range.begin(), range.end(), std::move(init), op,
+                          grain);
+}
+
+template <class Range, class OutIt, class BinaryOp = std::plus<>,
+          class = enable_if_range<Range>>
+OutIt inclusive_scan(Range& range, OutIt d_first, BinaryOp op = {},
+                     size_t grain = kDefaultGrain) {
+  return parallel::inclusive_scan(range.begin(), range.end(), d_first, op,
+                                  grain);
+}
+
+template <class Range, class Compare = std::less<>,
+          class = enable_if_range<Range>>
+void sort(Range& range, Compare comp = {}, size_t grain = kDefaultGrain) {
+  parallel::sort(range.begin(), range.end(), comp, grain);
+}
+
+template <class Range, class Compare = std::less<>,
+          class = enable_if_range<Range>>
+void stable_sort(Range& range, Compare comp = {},
+                 size_t grain = kDefaultGrain) {
+  parallel::stable_sort(range.begin(), range.end(), comp, grain);
+}
+
+template <class Range, class Predicate, class = enable_if_range<Range>>
+auto partition(Range& range, Predicate pred, size_t grain = kDefaultGrain) {
+  return parallel::partition(range.begin(), range.end(), pred, grain);
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_PARALLEL_H
@@ -0,0 +1,200 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+namespace parallel {
+// Пул потоков с перехватом задач. У каждого потока своя очередь: свои задачи
+// он берет с конца, а когда она пуста, забирает самые старые задачи из
+// чужих очередей. Поток, который ждет задачи, тоже выполняет задачи пула,
+// поэтому вложенные параллельные вызовы не блокируют друг друга
+class thread_pool {
+ public:
+  using task = std::function<void()>;
+
+  explicit thread_pool(unsigned threads = default_threads())
+      : __queues(std::max(threads, 1u)),
+        __pending{0},
+        __next{0},
+        __stop{false} {
+    for (auto& queue : __queues) queue = std::make_unique<worker_queue>();
+    for (unsigned i = 0; i < threads; ++i)
+      __workers.emplace_back([this, i]() { __work(i); });
+  }
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(__sleep_mutex);
+      __stop = true;
+    }
+    __wake.notify_all();
+    for (std::thread& worker : __workers) worker.join();
+  }
+
+  // Этот метод возвращает количество рабочих потоков
+  unsigned size() const noexcept {
+    return static_cast<unsigned>(__workers.size());
+  }
+
+  // Этот метод ставит задачу в очередь. Задачи из рабочего потока попадают
+  // в его очередь, остальные распределяются по очередям по кругу
+  void submit(task job) {
+    size_t index = __current_pool() == this
+                       ? __current_index()
+                       : __next.fetch_add(1) % __queues.size();
+    {
+      std::lock_guard<std::mutex> lock(__queues[index]->mutex);
+      __queues[index]->tasks.push_back(std::move(job));
+    }
+    ++__pending;
+    {
+      std::lock_guard<std::mutex> lock(__sleep_mutex);
+    }
+    __wake.notify_one();
+  }
+
+  // Этот метод выполняет одну задачу из очередей пула, если она есть
+  bool run_pending() {
+    task job;
+    size_t own = __current_pool() == this ? __current_index() : 0;
+    bool found = __take(own, job);
+    if (found) job();
+    return found;
+  }
+
+  // Этот метод возвращает размер пула по умолчанию: значение переменной
+  // окружения S21_THREADS, если оно задано, иначе количество ядер
+  static unsigned default_threads() noexcept {
+    const char* env = std::getenv("S21_THREADS");
+    unsigned long threads = env ? std::strtoul(env, nullptr, 10) : 0;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    return static_cast<unsigned>(std::max(threads, 1ul));
+  }
+
+ private:
+  struct worker_queue {
+    std::mutex mutex;
+    std::deque<task> tasks;
+  };
+
+  std::vector<std::unique_ptr<worker_queue>> __queues;
+  std::vector<std::thread> __workers;
+  std::mutex __sleep_mutex;
+  std::condition_variable __wake;
+  std::atomic<size_t> __pending, __next;
+  bool __stop;
+
+  static const thread_pool*& __current_pool() noexcept {
+    static thread_local const thread_pool* pool = nullptr;
+    return pool;
+  }
+  static size_t& __current_index() noexcept {
+    static thread_local size_t index = 0;
+    return index;
+  }
+
+  // Берет задачу с конца своей очереди или с начала чужой
+  bool __take(size_t own, task& job) {
+    bool found = false;
+    for (size_t i = 0; !found && i < __queues.size(); ++i) {
+      worker_queue& queue = *__queues[(own + i) % __queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        if (i == 0) {
+          job = std::move(queue.tasks.back());
+          queue.tasks.pop_back();
+        } else {
+          job = std::move(queue.tasks.front());
+          queue.tasks.pop_front();
+        }
+        found = true;
+      }
+    }
+    if (found) --__pending;
+    return found;
+  }
+
+  void __work(size_t index) {
+    __current_pool() = this;
+    __current_index() = index;
+    task job;
+    while (true) {
+      if (__take(index, job)) {
+        job();
+        job = nullptr;
+      } else {
+        std::unique_lock<std::mutex> lock(__sleep_mutex);
+        __wake.wait(lock, [this]() { return __stop || __pending > 0; });
+        if (__stop) break;
+      }
+    }
+  }
+};
+
+// Этот метод возвращает общий пул с потоком на каждое ядро
+inline thread_pool& default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+// Группа задач, завершения которых можно дождаться. Исключение первой
+// упавшей задачи пробрасывается из wait
+class task_group {
+ public:
+  explicit task_group(thread_pool& pool = default_pool())
+      : __pool(pool), __remaining{0} {}
+  task_group(const task_group&) = delete;
+  task_group& operator=(const task_group&) = delete;
+  ~task_group() {
+    try {
+      wait();
+    } catch (...) {
+    }
+  }
+
+  // Этот метод запускает f в пуле
+  template <class Func>
+  void run(Func f) {
+    ++__remaining;
+    __pool.submit([this, f]() {
+      try {
+        f();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(__error_mutex);
+        if (!__error) __error = std::current_exception();
+      }
+      --__remaining;
+    });
+  }
+
+  // Этот метод ждет завершения всех задач, выполняя задачи пула
+  void wait() {
+    while (__remaining > 0)
+      if (!__pool.run_pending()) std::this_thread::yield();
+    if (__error) std::rethrow_exception(std::exchange(__error, nullptr));
+  }
+
+ private:
+  thread_pool& __pool;
+  std::atomic<size_t> __remaining;
+  std::mutex __error_mutex;
+  std::exception_ptr __error;
+};
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_THREAD_POOL_H
@@ -0,0 +1,550 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SIMD_X86_KERNELS
+#endif
+
+namespace s21 {
+namespace simd {
+// Поиск и свертки над непрерывными массивами арифметических типов: find,
+// count, min, max и sum. Для int32_t и float есть ядра SSE2, AVX2 и
+// AVX-512, нужное выбирается по возможностям процессора при первом вызове.
+// Остальные типы и хвосты, которые не заполняют целый регистр,
+// обрабатываются обычным циклом
+
+// Наборы инструкций в порядке возрастания ширины регистров
+enum class isa { scalar, sse2, avx2, avx512 };
+
+namespace detail {
+template <class T>
+inline constexpr bool vectorized =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, float>;
+
+inline isa detect() noexcept {
+#ifdef S21_SIMD_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return isa::avx512;
+  if (__builtin_cpu_supports("avx2")) return isa::avx2;
+  return isa::sse2;
+#else
+  return isa::scalar;
+#endif
+}
+
+// Сложение, при котором 32-битные целые переполняются по модулю 2^32
+template <class T>
+T add(T a, T b) noexcept {
+  if constexpr (std::is_same_v<T, int32_t>)
+    return static_cast<T>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+  else
+    return a + b;
+}
+
+inline std::atomic<isa>& limit() noexcept {
+  static std::atomic<isa> value{isa::avx512};
+  return value;
+}
+
+/*
+  ЯДРА SSE2
+*/
+
+// Все ядра обрабатывают только целые регистры. find возвращает индекс
+// первого совпадения или начало хвоста, остальные ядра записывают начало
+// хвоста в i и возвращают результат для [0, i)
+
+#ifdef S21_SIMD_X86_KERNELS
+template <class T>
+__attribute__((target("sse2"))) size_t find_sse2(const T* data, size_t n,
+                                                  T value) noexcept {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int mask;
+    if constexpr (std::is_same_v<T, float>) {
+      mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i),
+                                          _mm_set1_ps(value)));
+    } else {
+      __m128i items =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      mask = _mm_movemask_ps(_mm_castsi128_ps(
+          _mm_cmpeq_epi32(items, _mm_set1_epi32(value))));
+    }
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+template <class T>
+__attribute__((target("sse2"))) size_t count_sse2(const T* data, size_t n,
+                                                   T value,
+                                                   size_t& i) noexcept {
+  // В SSE2 нет popcnt, и __builtin_popcount здесь стал бы вызовом
+  // библиотечной функции на каждые четыре элемента. Вместо этого сравнение,
+  // дающее -1 в совпавших дорожках, вычитается из четырех счетчиков.
+  // Счетчики сбрасываются в result раньше, чем могут переполниться
+  constexpr size_t kBlock = size_t{1} << 30;
+  size_t result = 0;
+  for (i = 0; i + 4 <= n;) {
+    size_t block_end = n - i > kBlock ? i + kBlock : n;
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 4 <= block_end; i += 4) {
+      __m128i equal;
+      if constexpr (std::is_same_v<T, float>) {
+        equal = _mm_castps_si128(
+            _mm_cmpeq_ps(_mm_loadu_ps(data + i), _mm_set1_ps(value)));
+      } else {
+        equal = _mm_cmpeq_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)),
+            _mm_set1_epi32(value));
+      }
+      acc = _mm_sub_epi32(acc, equal);
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    result += size_t{lanes[0]} + lanes[1] + lanes[2] + lanes[3];
+  }
+  return result;
+}
+
+template <bool Max, class T>
+__attribute__((target("sse2"))) T extremum_sse2(const T* data, size_t n,
+                                                size_t& i) noexcept {
+  T lanes[4] = {};
+  i = 0;
+  if (n >= 4) {
+    if constexpr (std::is_same_v<T, float>) {
+      __m128 acc = _mm_loadu_ps(data);
+      for (i = 4; i + 4 <= n; i += 4) {
+        __m128 items = _mm_loadu_ps(data + i);
+        acc = Max ? _mm_max_ps(items, acc) : _mm_min_ps(items, acc);
+      }
+      _mm_storeu_ps(lanes, acc);
+    } else {
+      // В SSE2 нет min/max для 32-битных целых, поэтому выбор делается
+      // маской сравнения
+      __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+      for (i = 4; i + 4 <= n; i += 4) {
+        __m128i items =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i better =
+            Max ? _mm_cmpgt_epi32(items, acc) : _mm_cmplt_epi32(items, acc);
+        acc = _mm_or_si128(_mm_and_si128(better, items),
+                           _mm_andnot_si128(better, acc));
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    }
+  }
+  T result = i ? lanes[0] : data[0];
+  for (size_t lane = 1; i && lane < 4; ++lane)
+    if (Max ? result < lanes[lane] : lanes[lane] < result)
+      result = lanes[lane];
+  return result;
+}
+
+template <class T>
+__attribute__((target("sse2"))) T sum_sse2(const T* data, size_t n,
+                                           size_t& i) noexcept {
+  T lanes[4] = {};
+  if constexpr (std::is_same_v<T, float>) {
+    __m128 acc = _mm_setzero_ps();
+    for (i = 0; i + 4 <= n; i += 4)
+      acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+    _mm_storeu_ps(lanes, acc);
+  } else {
+    __m128i acc = _mm_setzero_si128();
+    for (i = 0; i + 4 <= n; i += 4)
+      acc = _mm_add_epi32(
+          acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  }
+  return add(add(lanes[0], lanes[1]), add(lanes[2], lanes[3]));
+}
+
+/*
+  ЯДРА AVX2
+*/
+
+template <class T>
+__attribute__((target("avx2"))) size_t find_avx2(const T* data, size_t n,
+                                                  T value) noexcept {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int mask;
+    if constexpr (std::is_same_v<T, float>) {
+      mask = _mm256_movemask_ps(_mm256_cmp_ps(
+          _mm256_loadu_ps(data + i), _mm256_set1_ps(value), _CMP_EQ_OQ));
+    } else {
+      __m256i items =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+      mask = _mm256_movemask_ps(_mm256_castsi256_ps(
+          _mm256_cmpeq_epi32(items, _mm256_set1_epi32(value))));
+    }
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+template <class T>
+__attribute__((target("avx2"))) size_t count_avx2(const T* data, size_t n,
+                                                   T value,
+                                                   size_t& i) noexcept {
+  size_t result = 0;
+  for (i = 0; i + 8 <= n; i += 8) {
+    int mask;
+    if constexpr (std::is_same_v<T, float>) {
+      mask = _mm256_movemask_ps(_mm256_cmp_ps(
+          _mm256_loadu_ps(data + i), _mm256_set1_ps(value), _CMP_EQ_OQ));
+    } else {
+      __m256i items =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+      mask = _mm256_movemask_ps(_mm256_castsi256_ps(
+          _mm256_cmpeq_epi32(items, _mm256_set1_epi32(value))));
+    }
+    result += __builtin_popcount(mask);
+  }
+  return result;
+}
+
+template <bool Max, class T>
+__attribute__((target("avx2"))) T extremum_avx2(const T* data, size_t n,
+                                                size_t& i) noexcept {
+  T lanes[8] = {};
+  i = 0;
+  if (n >= 8) {
+    if constexpr (std::is_same_v<T, float>) {
+      __m256 acc = _mm256_loadu_ps(data);
+      for (i = 8; i + 8 <= n; i += 8) {
+        __m256 items = _mm256_loadu_ps(data + i);
+        acc = Max ? _mm256_max_ps(items, acc) : _mm256_min_ps(items, acc);
+      }
+      _mm256_storeu_ps(lanes, acc);
+    } else {
+      __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+      for (i = 8; i + 8 <= n; i += 8) {
+        __m256i items =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc = Max ? _mm256_max_epi32(items, acc) : _mm256_min_epi32(items, acc);
+      }
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    }
+  }
+  T result = i ? lanes[0] : data[0];
+  for (size_t lane = 1; i && lane < 8; ++lane)
+    if (Max ? result < lanes[lane] : lanes[lane] < result)
+      result = lanes[lane];
+  return result;
+}
+
+template <class T>
+__attribute__((target("avx2"))) T sum_avx2(const T* data, size_t n,
+                                           size_t& i) noexcept {
+  T lanes[8] = {};
+  if constexpr (std::is_same_v<T, float>) {
+    __m256 acc = _mm256_setzero_ps();
+    for (i = 0; i + 8 <= n; i += 8)
+      acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+    _mm256_storeu_ps(lanes, acc);
+  } else {
+    __m256i acc = _mm256_setzero_si256();
+    for (i = 0; i + 8 <= n; i += 8)
+      acc = _mm256_add_epi32(
+          acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  }
+  return add(add(add(lanes[0], lanes[1]), add(lanes[2], lanes[3])),
+             add(add(lanes[4], lanes[5]), add(lanes[6], lanes[7])));
+}
+
+/*
+  ЯДРА AVX-512
+*/
+
+// В GCC 12 встроенные функции AVX-512 заполняют неиспользуемый операнд
+// самоинициализированной переменной, и при -O2 это дает ложные
+// -Wuninitialized и -Wmaybe-uninitialized, которые ломают сборку с -Werror
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+template <class T>
+__attribute__((target("avx512f"))) size_t find_avx512(const T* data, size_t n,
+                                                      T value) noexcept {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __mmask16 mask;
+    if constexpr (std::is_same_v<T, float>) {
+      mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i),
+                                _mm512_set1_ps(value), _CMP_EQ_OQ);
+    } else {
+      mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i),
+                                     _mm512_set1_epi32(value));
+    }
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+template <class T>
+__attribute__((target("avx512f"))) size_t count_avx512(const T* data, size_t n,
+                                                       T value,
+                                                       size_t& i) noexcept {
+  size_t result = 0;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __mmask16 mask;
+    if constexpr (std::is_same_v<T, float>) {
+      mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i),
+                                _mm512_set1_ps(value), _CMP_EQ_OQ);
+    } else {
+      mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i),
+                                     _mm512_set1_epi32(value));
+    }
+    result += __builtin_popcount(mask);
+  }
+  return result;
+}
+
+template <bool Max, class T>
+__attribute__((target("avx512f"))) T extremum_avx512(const T* data, size_t n,
+                                                    size_t& i) noexcept {
+  i = 0;
+  T result = data[0];
+  if (n >= 16) {
+    if constexpr (std::is_same_v<T, float>) {
+      __m512 acc = _mm512_loadu_ps(data);
+      for (i = 16; i + 16 <= n; i += 16) {
+        __m512 items = _mm512_loadu_ps(data + i);
+        acc = Max ? _mm512_max_ps(items, acc) : _mm512_min_ps(items, acc);
+      }
+      result = Max ? _mm512_reduce_max_ps(acc) : _mm512_reduce_min_ps(acc);
+    } else {
+      __m512i acc = _mm512_loadu_si512(data);
+      for (i = 16; i + 16 <= n; i += 16) {
+        __m512i items = _mm512_loadu_si512(data + i);
+        acc = Max ? _mm512_max_epi32(items, acc) : _mm512_min_epi32(items, acc);
+      }
+      result =
+          Max ? _mm512_reduce_max_epi32(acc) : _mm512_reduce_min_epi32(acc);
+    }
+  }
+  return result;
+}
+
+template <class T>
+__attribute__((target("avx512f"))) T sum_avx512(const T* data, size_t n,
+                                               size_t& i) noexcept {
+  T result;
+  if constexpr (std::is_same_v<T, float>) {
+    __m512 acc = _mm512_setzero_ps();
+    for (i = 0; i + 16 <= n; i += 16)
+      acc = _mm512_add_ps(acc, _mm512_loadu_ps(data + i));
+    result = _mm512_reduce_add_ps(acc);
+  } else {
+    __m512i acc = _mm512_setzero_si512();
+    for (i = 0; i + 16 <= n; i += 16)
+      acc = _mm512_add_epi32(acc, _mm512_loadu_si512(data + i));
+    result = _mm512_reduce_add_epi32(acc);
+  }
+  return result;
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+}  // namespace detail
+
+// Этот метод возвращает набор инструкций, который поддерживает процессор
+inline isa detected_isa() noexcept {
+  static const isa level = detail::detect();
+  return level;
+}
+
+// Этот метод возвращает набор инструкций, которым пользуются ядра
+inline isa active_isa() noexcept {
+  isa limit = detail::limit().load(std::memory_order_relaxed);
+  return detected_isa() < limit ? detected_isa() : limit;
+}
+
+// Этот метод запрещает ядрам инструкции шире level. isa::scalar оставляет
+// только обычные циклы, например для сравнения скорости
+inline void limit_isa(isa level) noexcept {
+  detail::limit().store(level, std::memory_order_relaxed);
+}
+
+/*
+  АЛГОРИТМЫ
+*/
+
+// Этот метод возвращает указатель на первый элемент, равный value, или last
+template <class T>
+const T* find(const T* first, const T* last, T value) noexcept {
+  size_t n = last - first, i = 0;
+#ifdef S21_SIMD_X86_KERNELS
+  if constexpr (detail::vectorized<T>) {
+    switch (active_isa()) {
+      case isa::avx512:
+        i = detail::find_avx512(first, n, value);
+        break;
+      case isa::avx2:
+        i = detail::find_avx2(first, n, value);
+        break;
+      case isa::sse2:
+        i = detail::find_sse2(first, n, value);
+        break;
+      case isa::scalar:
+        break;
+    }
+  }
+#endif
+  while (i < n && !(first[i] == value)) ++i;
+  return first + i;
+}
+
+// Этот метод возвращает количество элементов, равных value
+template <class T>
+size_t count(const T* first, const T* last, T value) noexcept {
+  size_t n = last - first, i = 0, result = 0;
+#ifdef S21_SIMD_X86_KERNELS
+  if constexpr (detail::vectorized<T>) {
+    switch (active_isa()) {
+      case isa::avx512:
+        result = detail::count_avx512(first, n, value, i);
+        break;
+      case isa::avx2:
+        result = detail::count_avx2(first, n, value, i);
+        break;
+      case isa::sse2:
+        result = detail::count_sse2(first, n, value, i);
+        break;
+      case isa::scalar:
+        break;
+    }
+  }
+#endif
+  for (; i < n; ++i) result += first[i] == value;
+  return result;
+}
+
+namespace detail {
+template <bool Max, class T>
+T extremum(const T* first, const T* last) {
+  if (first == last) throw std::invalid_argument("Range is empty");
+  size_t n = last - first, i = 0;
+  T result = first[0];
+#ifdef S21_SIMD_X86_KERNELS
+  if constexpr (vectorized<T>) {
+    switch (active_isa()) {
+      case isa::avx512:
+        result = extremum_avx512<Max>(first, n, i);
+        break;
+      case isa::avx2:
+        result = extremum_avx2<Max>(first, n, i);
+        break;
+      case isa::sse2:
+        result = extremum_sse2<Max>(first, n, i);
+        break;
+      case isa::scalar:
+        break;
+    }
+  }
+#endif
+  for (; i < n; ++i)
+    if (Max ? result < first[i] : first[i] < result) result = first[i];
+  return result;
+}
+}  // namespace detail
+
+// Эти методы возвращают наименьший и наибольший элемент непустого
+// диапазона. Если в диапазоне есть NaN, результат зависит от ширины
+// регистров
+template <class T>
+T min(const T* first, const T* last) {
+  return detail::extremum<false>(first, last);
+}
+
+template <class T>
+T max(const T* first, const T* last) {
+  return detail::extremum<true>(first, last);
+}
+
+// Этот метод возвращает сумму элементов. Сумма 32-битных целых считается
+// по модулю 2^32, float складываются в порядке, который зависит от ширины
+// регистров, поэтому результат может отличаться от последовательного в
+// последних разрядах
+template <class T>
+T sum(const T* first, const T* last) noexcept {
+  size_t n = last - first, i = 0;
+  T result{};
+#ifdef S21_SIMD_X86_KERNELS
+  if constexpr (detail::vectorized<T>) {
+    switch (active_isa()) {
+      case isa::avx512:
+        result = detail::sum_avx512(first, n, i);
+        break;
+      case isa::avx2:
+        result = detail::sum_avx2(first, n, i);
+        break;
+      case isa::sse2:
+        result = detail::sum_sse2(first, n, i);
+        break;
+      case isa::scalar:
+        break;
+    }
+  }
+#endif
+  for (; i < n; ++i) result = detail::add(result, first[i]);
+  return result;
+}
+
+/*
+  ПЕРЕГРУЗКИ ДЛЯ КОНТЕЙНЕРОВ
+*/
+
+// Контейнеры с data() и size(): s21::vector, s21::array, s21::span и т.п.
+template <class Container>
+using element_t = std::remove_const_t<
+    std::remove_pointer_t<decltype(std::declval<Container&>().data())>>;
+
+template <class Container, class T = element_t<Container>,
+          class = std::enable_if_t<std::is_arithmetic_v<T>>>
+const T* find(Container&& items, element_t<Container> value) noexcept {
+  return simd::find<T>(items.data(), items.data() + items.size(), value);
+}
+
+template <class Container, class T = element_t<Container>,
+          class = std::enable_if_t<std::is_arithmetic_v<T>>>
+size_t count(Container&& items, element_t<Container> value) noexcept {
+  return simd::count<T>(items.data(), items.data() + items.size(), value);
+}
+
+template <class Container, class T = element_t<Container>,
+          class = std::enable_if_t<std::is_arithmetic_v<T>>>
+T min(Container&& items) {
+  return simd::min<T>(items.data(), items.data() + items.size());
+}
+
+template <class Container, class T = element_t<Container>,
+          class = std::enable_if_t<std::is_arithmetic_v<T>>>
+T max(Container&& items) {
+  return simd::max<T>(items.data(), items.data() + items.size());
+}
+
+template <class Container, class T = element_t<Container>,
+          class = std::enable_if_t<std::is_arithmetic_v<T>>>
+T sum(Container&& items) noexcept {
+  return simd::sum<T>(items.data(), items.data() + items.size());
+}
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_SIMD_H
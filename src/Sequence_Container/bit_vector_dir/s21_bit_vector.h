@@ -0,0 +1,307 @@
+#ifndef S21_BIT_VECTOR_H
+#define S21_BIT_VECTOR_H
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "../vector_dir/s21_vector.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_BIT_VECTOR_X86_KERNELS
+#endif
+
+namespace s21 {
+// Подсчет единиц в массиве слов без особых инструкций: биты складываются
+// параллельно внутри слова, сначала парами, потом четверками и байтами
+inline size_t __bit_count_portable(const uint64_t* words, size_t n) noexcept {
+  size_t result = 0;
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t word = words[i];
+    word -= (word >> 1) & 0x5555555555555555ULL;
+    word = (word & 0x3333333333333333ULL) +
+           ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    result += static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+  }
+  return result;
+}
+
+#ifdef S21_BIT_VECTOR_X86_KERNELS
+// Без -mpopcnt __builtin_popcountll компилируется в вызов библиотечной
+// функции. Здесь инструкция popcnt разрешена только для этого ядра, а
+// вызывать его можно, если процессор ее поддерживает
+__attribute__((target("popcnt"))) inline size_t __bit_count_popcnt(
+    const uint64_t* words, size_t n) noexcept {
+  size_t result = 0;
+  for (size_t i = 0; i < n; ++i)
+    result += static_cast<size_t>(__builtin_popcountll(words[i]));
+  return result;
+}
+#endif
+
+// Этот метод выбирает ядро подсчета по процессору при первом вызове
+inline size_t __bit_count(const uint64_t* words, size_t n) noexcept {
+#ifdef S21_BIT_VECTOR_X86_KERNELS
+  static const bool has_popcnt =
+      (__builtin_cpu_init(), __builtin_cpu_supports("popcnt"));
+  if (has_popcnt) return __bit_count_popcnt(words, n);
+#endif
+  return __bit_count_portable(words, n);
+}
+
+// Упакованный вектор битов: 64 флага в одном слове s21::vector<uint64_t>.
+// Биты после size() в последнем слове всегда равны нулю, поэтому подсчет и
+// поиск работают сразу по словам
+class bit_vector {
+ public:
+  class reference;
+  using value_type = bool;
+  using word_type = uint64_t;
+  using size_type = size_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr size_type kWordBits = 64;
+
+  bit_vector() = default;
+  explicit bit_vector(size_type n, bool value = false) { resize(n, value); }
+  bit_vector(std::initializer_list<bool> const& items) {
+    reserve(items.size());
+    for (bool item : items) push_back(item);
+  }
+  bit_vector(const bit_vector& other)
+      : __words(other.__words), __size(other.__size) {}
+  bit_vector(bit_vector&& other) noexcept
+      : __words(std::move(other.__words)), __size(other.__size) {
+    other.__size = 0;
+  }
+  bit_vector& operator=(const bit_vector& other) {
+    if (this != &other) {
+      bit_vector buf(other);
+      swap(buf);
+    }
+    return *this;
+  }
+  bit_vector& operator=(bit_vector&& other) noexcept {
+    if (this != &other) {
+      swap(other);
+      other.clear();
+    }
+    return *this;
+  }
+
+  // Прокси на один бит
+  class reference {
+   public:
+    reference(word_type* word, word_type mask) : __word(word), __mask(mask) {}
+    reference(const reference& other) = default;
+
+    operator bool() const { return (*__word & __mask) != 0; }
+    reference& operator=(bool value) {
+      if (value)
+        *__word |= __mask;
+      else
+        *__word &= ~__mask;
+      return *this;
+    }
+    reference& operator=(const reference& other) {
+      return *this = static_cast<bool>(other);
+    }
+    // Этот метод инвертирует бит
+    void flip() { *__word ^= __mask; }
+
+   private:
+    word_type* __word;
+    word_type __mask;
+  };
+
+  /*
+  ДОСТУП К ЭЛЕМЕНТАМ
+  */
+
+  reference operator[](size_type i) {
+    return reference(__words.data() + i / kWordBits, __bit(i));
+  }
+  bool operator[](size_type i) const {
+    return (__words[i / kWordBits] & __bit(i)) != 0;
+  }
+  reference at(size_type i) {
+    __check(i);
+    return (*this)[i];
+  }
+  bool test(size_type i) const {
+    __check(i);
+    return (*this)[i];
+  }
+  bool front() const { return (*this)[0]; }
+  bool back() const { return (*this)[__size - 1]; }
+  // Этот метод возвращает слова, в которых хранятся биты
+  word_type* data() { return __words.data(); }
+  const word_type* data() const { return __words.data(); }
+
+  /*
+  РАЗМЕРЫ
+  */
+
+  bool empty() const { return __size == 0; }
+  size_type size() const { return __size; }
+  size_type capacity() const { return __words.capacity() * kWordBits; }
+  void reserve(size_type bits) { __words.reserve(__words_for(bits)); }
+  void shrink_to_fit() { __words.shrink_to_fit(); }
+
+  /*
+  ИЗМЕНЕНИЕ КОНТЕЙНЕРА
+  */
+
+  void clear() {
+    __words.clear();
+    __size = 0;
+  }
+  void push_back(bool value) {
+    if (__size % kWordBits == 0) __words.push_back(0);
+    ++__size;
+    (*this)[__size - 1] = value;
+  }
+  void pop_back() {
+    (*this)[__size - 1] = false;
+    --__size;
+    if (__size % kWordBits == 0) __words.pop_back();
+  }
+  // Этот метод меняет размер. Новые биты получают значение value, целые
+  // слова заполняются сразу
+  void resize(size_type n, bool value = false) {
+    size_type old_size = __size;
+    if (n > old_size && value && old_size % kWordBits != 0)
+      __words[old_size / kWordBits] |= ~word_type{0} << (old_size % kWordBits);
+    __words.resize(__words_for(n), value ? ~word_type{0} : 0);
+    __size = n;
+    __clear_tail();
+  }
+  void swap(bit_vector& other) {
+    __words.swap(other.__words);
+    std::swap(__size, other.__size);
+  }
+
+  void set(size_type i, bool value = true) { at(i) = value; }
+  void reset(size_type i) { at(i) = false; }
+  void flip(size_type i) { at(i).flip(); }
+  // Эти методы меняют все биты сразу, по словам
+  void set() {
+    for (word_type& word : __words) word = ~word_type{0};
+    __clear_tail();
+  }
+  void reset() {
+    for (word_type& word : __words) word = 0;
+  }
+  void flip() {
+    for (word_type& word : __words) word = ~word;
+    __clear_tail();
+  }
+
+  /*
+  ПОИСК И ПОДСЧЕТ
+  */
+
+  // Этот метод возвращает количество установленных битов
+  size_type count() const {
+    return __bit_count(__words.data(), __words.size());
+  }
+  bool any() const { return find_first() != npos; }
+  bool none() const { return !any(); }
+  bool all() const { return count() == __size; }
+
+  // Этот метод возвращает номер первого установленного бита или npos
+  size_type find_first() const { return __find_from(0); }
+
+  // Этот метод возвращает номер установленного бита после pos или npos
+  size_type find_next(size_type pos) const {
+    return pos + 1 >= __size ? npos : __find_from(pos + 1);
+  }
+
+  /*
+  ПОБИТОВЫЕ ОПЕРАЦИИ
+  */
+
+  bit_vector& operator&=(const bit_vector& other) {
+    __check_size(other);
+    for (size_type i = 0; i < __words.size(); ++i)
+      __words[i] &= other.__words[i];
+    return *this;
+  }
+  bit_vector& operator|=(const bit_vector& other) {
+    __check_size(other);
+    for (size_type i = 0; i < __words.size(); ++i)
+      __words[i] |= other.__words[i];
+    return *this;
+  }
+  bit_vector& operator^=(const bit_vector& other) {
+    __check_size(other);
+    for (size_type i = 0; i < __words.size(); ++i)
+      __words[i] ^= other.__words[i];
+    return *this;
+  }
+  bit_vector operator~() const {
+    bit_vector result(*this);
+    result.flip();
+    return result;
+  }
+
+  bool operator==(const bit_vector& other) const {
+    bool result = __size == other.__size;
+    for (size_type i = 0; result && i < __words.size(); ++i)
+      result = __words[i] == other.__words[i];
+    return result;
+  }
+  bool operator!=(const bit_vector& other) const { return !(*this == other); }
+
+ private:
+  s21::vector<word_type> __words;
+  size_type __size = 0;
+
+  static size_type __words_for(size_type bits) {
+    return (bits + kWordBits - 1) / kWordBits;
+  }
+  static word_type __bit(size_type i) {
+    return word_type{1} << (i % kWordBits);
+  }
+
+  // word не должно быть нулем
+  static size_type __ctz(word_type word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_type>(__builtin_ctzll(word));
+#else
+    size_type result = 0;
+    for (; (word & 1) == 0; word >>= 1) ++result;
+    return result;
+#endif
+  }
+
+  // Обнуляет биты последнего слова после size()
+  void __clear_tail() {
+    if (__size % kWordBits != 0)
+      __words[__size / kWordBits] &= __bit(__size) - 1;
+  }
+
+  size_type __find_from(size_type pos) const {
+    size_type index = pos / kWordBits;
+    size_type result = npos;
+    if (index < __words.size()) {
+      // Биты слова до pos отбрасываются
+      word_type word = __words[index] & (~word_type{0} << (pos % kWordBits));
+      while (word == 0 && ++index < __words.size()) word = __words[index];
+      if (word != 0) result = index * kWordBits + __ctz(word);
+    }
+    return result;
+  }
+
+  void __check(size_type i) const {
+    if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  }
+
+  void __check_size(const bit_vector& other) const {
+    if (__size != other.__size)
+      throw std::invalid_argument("Bit vectors have different sizes");
+  }
+};
+}  // namespace s21
+
+#endif  // S21_BIT_VECTOR_H
@@ -1,9 +1,27 @@
 #ifndef S21_DEQUE_CONTAINER_H
 #define S21_DEQUE_CONTAINER_H
 
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../indexed_iterator.h"
 
 namespace s21 {
+// Двусторонняя очередь на карте блоков. Элементы лежат в блоках
+// фиксированного размера, карта - массив указателей на блоки. Позиция
+// элемента в карте - это start + i, поэтому блок и место в нем находятся
+// сдвигом и маской. При росте переносятся только указатели на блоки, сами
+// элементы остаются на месте. Опустевший блок сохраняется и используется
+// снова, так что очередь, в которую пишут с одного конца и читают с
+// другого, не выделяет память
 template <class Type>
 class deque {
  public:
@@ -11,6 +29,8 @@ class deque {
   using reference = Type &;
   using const_reference = const Type &;
   using size_type = std::size_t;
+  using iterator = indexed_iterator<deque, Type>;
+  using const_iterator = indexed_iterator<deque, const Type>;
 
   /*
   Публичные методы для взаимодействия с классом
@@ -42,10 +62,10 @@ class deque {
   */
 
   // Проверяет контейнер на пустоту
-  bool empty();
+  bool empty() const;
 
   // Возвращает количество элементов в контейнере
-  size_type size();
+  size_type size() const;
 
   /*
   Публичные методы для изменения контейнера:
@@ -53,16 +73,29 @@ class deque {
 
   // Добавляет элемент в конец очереди
   void push_back(const_reference data);
+  void push_back(value_type &&data);
+
+  // Создает элемент в конце очереди из аргументов args
+  template <class... Args>
+  reference emplace_back(Args &&...args);
 
   // Удаляет последний элемент из очереди
   void pop_back();
 
   // Добавляет элемент в начало очереди
   void push_front(const_reference data);
+  void push_front(value_type &&data);
+
+  // Создает элемент в начале очереди из аргументов args
+  template <class... Args>
+  reference emplace_front(Args &&...args);
 
   // Удаляет элемент из начала очереди
   void pop_front();
 
+  // Удаляет все элементы. Один блок остается для повторного использования
+  void clear();
+
   // Этот метод меняет содержимое текущего объекта с other
   void swap(deque &other);
 
@@ -71,53 +104,81 @@ class deque {
   */
 
   // Этот метод возвращает ссылку на первый элемент очереди
+  reference front();
   const_reference front() const;
 
   // Этот метод возвращает ссылку на последний элемент очереди
+  reference back();
   const_reference back() const;
 
- private:
-  struct Node {
-    Type date;
-    Node *next;
-    Node *previous;
-    Node(Type data) {
-      date = data;
-      next = nullptr;
-      previous = nullptr;
-    }
-  };
+  // Этот метод возвращает элемент с номером i без проверки границ
+  reference operator[](size_type i);
+  const_reference operator[](size_type i) const;
+
+  // Этот метод возвращает элемент с номером i и проверяет границы
+  reference at(size_type i);
+  const_reference at(size_type i) const;
 
-  Node *first;
-  Node *last;
-  unsigned NodeCount;
+  /*
+  Итераторы
+  */
+
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+
+ private:
+  // Размер блока - степень двойки около 512 байт, но не меньше 16 элементов
+  static constexpr size_type BlockSize = sizeof(Type) <= 4    ? 128
+                                         : sizeof(Type) <= 8  ? 64
+                                         : sizeof(Type) <= 16 ? 32
+                                                              : 16;
+
+  Type **blocks;
+  size_type BlockCount;
+  // Позиция первого элемента в карте: блок start / BlockSize
+  size_type start;
+  size_type ElementCount;
+  // Пустой блок, который ждет повторного использования
+  Type *spare;
+
+  // Возвращает адрес элемента на позиции position карты
+  Type *slot(size_type position) const;
+
+  // Готовят место для нового элемента в конце и в начале очереди: при
+  // необходимости расширяют карту и выделяют блок
+  void PrepareBack();
+  void PrepareFront();
+
+  // Расставляет занятые блоки в середине карты. Если свободных мест мало,
+  // карта увеличивается вдвое
+  void Remap();
+
+  // Берет пустой блок: сохраненный или новый
+  Type *TakeBlock();
+
+  // Освобождает блок с номером index: он сохраняется, если сохраненного
+  // блока еще нет
+  void ReleaseBlock(size_type index);
 };
 
 template <class Type>
-deque<Type>::deque() {
-  NodeCount = 0;
-  first = nullptr;
-  last = nullptr;
-}
+deque<Type>::deque()
+    : blocks(nullptr),
+      BlockCount(0),
+      start(0),
+      ElementCount(0),
+      spare(nullptr) {}
 
 template <class Type>
-deque<Type>::deque(const deque &s) {
-  Node *buf_Node = s.first;
-  NodeCount = 0;
-  first = nullptr;
-  last = nullptr;
-  while (buf_Node != nullptr) {
-    this->push_back(buf_Node->date);
-    buf_Node = buf_Node->next;
-  }
+deque<Type>::deque(const deque &s) : deque() {
+  for (const_reference element : s) push_back(element);
 }
 
 template <class Type>
-deque<Type>::deque(deque &&s)
-    : first(s.first), last(s.last), NodeCount(s.NodeCount) {
-  s.first = nullptr;
-  s.last = nullptr;
-  s.NodeCount = 0;
+deque<Type>::deque(deque &&s) : deque() {
+  swap(s);
 }
 
 template <class Type>
@@ -146,102 +207,272 @@ deque<Type>::deque(std::initializer_list<value_type> const &items) : deque() {
 
 template <class Type>
 deque<Type>::~deque() {
-  while (!empty()) {
-    this->pop_front();
-  }
+  clear();
+  std::allocator<Type>().deallocate(spare, BlockSize);
+  std::allocator<Type *>().deallocate(blocks, BlockCount);
 }
 
 template <class Type>
-bool deque<Type>::empty() {
-  bool res = false;
-  if (NodeCount == 0) {
-    res = true;
-  }
-  return res;
+bool deque<Type>::empty() const {
+  return ElementCount == 0;
 }
 
 template <class Type>
-typename deque<Type>::size_type deque<Type>::size() {
-  return NodeCount;
+typename deque<Type>::size_type deque<Type>::size() const {
+  return ElementCount;
 }
 
 template <class Type>
 void deque<Type>::push_back(const_reference data) {
-  Node *new_elem = new Node(data);
-  if (last != nullptr) {
-    last->next = new_elem;
-    new_elem->previous = last;
-    new_elem->next = nullptr;
-    last = new_elem;
-  } else {
-    last = new_elem;
-    first = new_elem;
+  emplace_back(data);
+}
+
+template <class Type>
+void deque<Type>::push_back(value_type &&data) {
+  emplace_back(std::move(data));
+}
+
+template <class Type>
+template <class... Args>
+typename deque<Type>::reference deque<Type>::emplace_back(Args &&...args) {
+  // Элементы не переезжают, поэтому аргументы могут ссылаться на них
+  PrepareBack();
+  size_type position = start + ElementCount;
+  Type *place = slot(position);
+  try {
+    new (place) Type(std::forward<Args>(args)...);
+  } catch (...) {
+    // Блок, взятый под этот элемент, пуст и должен вернуться, как в pop_back
+    if (position % BlockSize == 0 || ElementCount == 0) {
+      ReleaseBlock(position / BlockSize);
+    }
+    throw;
   }
-  NodeCount += 1;
+  ++ElementCount;
+  return *place;
 }
 
 template <class Type>
 void deque<Type>::pop_back() {
-  if (last != nullptr) {
-    Node *pop_elem = last;
-    last = pop_elem->previous;
-    if (last != nullptr) {
-      last->next = nullptr;
-    } else {
-      first = nullptr;
+  if (ElementCount != 0) {
+    size_type position = start + ElementCount - 1;
+    slot(position)->~Type();
+    --ElementCount;
+    if (position % BlockSize == 0 || ElementCount == 0) {
+      ReleaseBlock(position / BlockSize);
     }
-    delete pop_elem;
-    NodeCount -= 1;
   }
 }
 
 template <class Type>
 void deque<Type>::push_front(const_reference data) {
-  Node *new_elem = new Node(data);
-  if (first != nullptr) {
-    first->previous = new_elem;
-    new_elem->next = first;
-    new_elem->previous = nullptr;
-    first = new_elem;
-  } else {
-    first = new_elem;
-    last = new_elem;
+  emplace_front(data);
+}
+
+template <class Type>
+void deque<Type>::push_front(value_type &&data) {
+  emplace_front(std::move(data));
+}
+
+template <class Type>
+template <class... Args>
+typename deque<Type>::reference deque<Type>::emplace_front(Args &&...args) {
+  PrepareFront();
+  Type *place = slot(start - 1);
+  try {
+    new (place) Type(std::forward<Args>(args)...);
+  } catch (...) {
+    if (start % BlockSize == 0 || ElementCount == 0) {
+      ReleaseBlock((start - 1) / BlockSize);
+    }
+    throw;
   }
-  NodeCount += 1;
+  --start;
+  ++ElementCount;
+  return *place;
 }
 
 template <class Type>
 void deque<Type>::pop_front() {
-  if (first != nullptr) {
-    Node *pop_element = first;
-    first = pop_element->next;
-    if (first == nullptr) {
-      last = nullptr;
-    } else {
-      first->previous = nullptr;
+  if (ElementCount != 0) {
+    size_type position = start;
+    slot(position)->~Type();
+    ++start;
+    --ElementCount;
+    if (start % BlockSize == 0 || ElementCount == 0) {
+      ReleaseBlock(position / BlockSize);
     }
-    delete pop_element;
-    NodeCount -= 1;
+  }
+}
+
+template <class Type>
+void deque<Type>::clear() {
+  while (!empty()) {
+    pop_back();
   }
 }
 
 template <class Type>
 void deque<Type>::swap(deque &other) {
-  std::swap(first, other.first);
-  std::swap(last, other.last);
-  std::swap(NodeCount, other.NodeCount);
+  std::swap(blocks, other.blocks);
+  std::swap(BlockCount, other.BlockCount);
+  std::swap(start, other.start);
+  std::swap(ElementCount, other.ElementCount);
+  std::swap(spare, other.spare);
 }
 
 template <class Type>
-typename deque<Type>::const_reference deque<Type>::back() const {
-  return last->date;
+typename deque<Type>::reference deque<Type>::front() {
+  return *slot(start);
 }
 
 template <class Type>
 typename deque<Type>::const_reference deque<Type>::front() const {
-  return first->date;
+  return *slot(start);
+}
+
+template <class Type>
+typename deque<Type>::reference deque<Type>::back() {
+  return *slot(start + ElementCount - 1);
+}
+
+template <class Type>
+typename deque<Type>::const_reference deque<Type>::back() const {
+  return *slot(start + ElementCount - 1);
+}
+
+template <class Type>
+typename deque<Type>::reference deque<Type>::operator[](size_type i) {
+  return *slot(start + i);
+}
+
+template <class Type>
+typename deque<Type>::const_reference deque<Type>::operator[](
+    size_type i) const {
+  return *slot(start + i);
+}
+
+template <class Type>
+typename deque<Type>::reference deque<Type>::at(size_type i) {
+  if (i >= ElementCount) throw std::out_of_range("Index is beyond the bounds");
+  return (*this)[i];
+}
+
+template <class Type>
+typename deque<Type>::const_reference deque<Type>::at(size_type i) const {
+  if (i >= ElementCount) throw std::out_of_range("Index is beyond the bounds");
+  return (*this)[i];
+}
+
+template <class Type>
+typename deque<Type>::iterator deque<Type>::begin() {
+  return iterator(this, 0);
+}
+
+template <class Type>
+typename deque<Type>::const_iterator deque<Type>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <class Type>
+typename deque<Type>::iterator deque<Type>::end() {
+  return iterator(this, ElementCount);
+}
+
+template <class Type>
+typename deque<Type>::const_iterator deque<Type>::end() const {
+  return const_iterator(this, ElementCount);
+}
+
+template <class Type>
+Type *deque<Type>::slot(size_type position) const {
+  return blocks[position / BlockSize] + position % BlockSize;
+}
+
+template <class Type>
+void deque<Type>::PrepareBack() {
+  size_type position = start + ElementCount;
+  if (position == BlockCount * BlockSize) {
+    Remap();
+    position = start + ElementCount;
+  }
+  if (blocks[position / BlockSize] == nullptr) {
+    blocks[position / BlockSize] = TakeBlock();
+  }
+}
+
+template <class Type>
+void deque<Type>::PrepareFront() {
+  if (start == 0) {
+    Remap();
+  }
+  size_type index = (start - 1) / BlockSize;
+  if (blocks[index] == nullptr) {
+    blocks[index] = TakeBlock();
+  }
+}
+
+template <class Type>
+void deque<Type>::Remap() {
+  size_type first_block = start / BlockSize;
+  size_type used = 0;
+  if (ElementCount != 0) {
+    used = (start + ElementCount - 1) / BlockSize - first_block + 1;
+  }
+  // Нужно место хотя бы под один новый блок с каждой стороны
+  Type **target = blocks;
+  size_type target_count = BlockCount;
+  if (BlockCount < used + 2 || BlockCount / 2 < used) {
+    target_count = std::max<size_type>(BlockCount * 2, 8);
+    target = std::allocator<Type *>().allocate(target_count);
+    std::fill(target, target + target_count, nullptr);
+  }
+  size_type new_first = (target_count - used) / 2;
+  if (used != 0) {
+    // Диапазоны могут пересекаться, std::copy_backward и std::copy
+    // выбираются по направлению сдвига
+    if (target == blocks && new_first > first_block) {
+      std::copy_backward(blocks + first_block, blocks + first_block + used,
+                         target + new_first + used);
+    } else {
+      std::copy(blocks + first_block, blocks + first_block + used,
+                target + new_first);
+    }
+  }
+  if (target == blocks) {
+    // Освободившиеся места карты обнуляются
+    for (size_type i = 0; i < target_count; ++i) {
+      if (i < new_first || i >= new_first + used) target[i] = nullptr;
+    }
+  } else {
+    std::allocator<Type *>().deallocate(blocks, BlockCount);
+    blocks = target;
+    BlockCount = target_count;
+  }
+  start = new_first * BlockSize + start % BlockSize;
+}
+
+template <class Type>
+Type *deque<Type>::TakeBlock() {
+  Type *block = spare;
+  if (block != nullptr) {
+    spare = nullptr;
+  } else {
+    block = std::allocator<Type>().allocate(BlockSize);
+  }
+  return block;
+}
+
+template <class Type>
+void deque<Type>::ReleaseBlock(size_type index) {
+  if (spare == nullptr) {
+    spare = blocks[index];
+  } else {
+    std::allocator<Type>().deallocate(blocks[index], BlockSize);
+  }
+  blocks[index] = nullptr;
 }
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,118 @@
+#ifndef S21_INDEXED_ITERATOR_H
+#define S21_INDEXED_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+// Итератор с произвольным доступом для контейнеров, у которых элемент
+// находится по номеру через operator[], как у s21::deque и
+// s21::ring_deque. Хранит контейнер и номер элемента, поэтому остается
+// верным, пока элемент с этим номером существует, даже если контейнер
+// перенес элементы в другую память. Value - const T у const_iterator
+template <class Container, class Value>
+class indexed_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value*;
+  using reference = Value&;
+  using size_type = std::size_t;
+  using owner_type = std::conditional_t<std::is_const_v<Value>,
+                                        const Container, Container>;
+
+  indexed_iterator() = default;
+  indexed_iterator(owner_type* owner, size_type index)
+      : __owner(owner), __index(index) {}
+  // iterator приводится к const_iterator
+  template <class Other, class = std::enable_if_t<
+                             std::is_convertible_v<Other*, Value*>>>
+  indexed_iterator(const indexed_iterator<Container, Other>& other)
+      : __owner(other.__owner), __index(other.__index) {}
+
+  reference operator*() const { return (*__owner)[__index]; }
+  pointer operator->() const { return &(*__owner)[__index]; }
+  reference operator[](difference_type n) const {
+    return (*__owner)[__index + n];
+  }
+
+  indexed_iterator& operator++() {
+    ++__index;
+    return *this;
+  }
+  indexed_iterator operator++(int) {
+    indexed_iterator buf(*this);
+    ++__index;
+    return buf;
+  }
+  indexed_iterator& operator--() {
+    --__index;
+    return *this;
+  }
+  indexed_iterator operator--(int) {
+    indexed_iterator buf(*this);
+    --__index;
+    return buf;
+  }
+  indexed_iterator& operator+=(difference_type n) {
+    __index += n;
+    return *this;
+  }
+  indexed_iterator& operator-=(difference_type n) {
+    __index -= n;
+    return *this;
+  }
+  indexed_iterator operator+(difference_type n) const {
+    return indexed_iterator(__owner, __index + n);
+  }
+  indexed_iterator operator-(difference_type n) const {
+    return indexed_iterator(__owner, __index - n);
+  }
+  // Сравнения и разность - друзья, чтобы iterator и const_iterator можно
+  // было смешивать с обеих сторон
+  friend difference_type operator-(const indexed_iterator& lhs,
+                                   const indexed_iterator& rhs) {
+    return static_cast<difference_type>(lhs.__index - rhs.__index);
+  }
+  friend indexed_iterator operator+(difference_type n,
+                                    const indexed_iterator& it) {
+    return it + n;
+  }
+
+  friend bool operator==(const indexed_iterator& lhs,
+                         const indexed_iterator& rhs) {
+    return lhs.__index == rhs.__index;
+  }
+  friend bool operator!=(const indexed_iterator& lhs,
+                         const indexed_iterator& rhs) {
+    return lhs.__index != rhs.__index;
+  }
+  friend bool operator<(const indexed_iterator& lhs,
+                        const indexed_iterator& rhs) {
+    return lhs.__index < rhs.__index;
+  }
+  friend bool operator>(const indexed_iterator& lhs,
+                        const indexed_iterator& rhs) {
+    return rhs < lhs;
+  }
+  friend bool operator<=(const indexed_iterator& lhs,
+                         const indexed_iterator& rhs) {
+    return !(rhs < lhs);
+  }
+  friend bool operator>=(const indexed_iterator& lhs,
+                         const indexed_iterator& rhs) {
+    return !(lhs < rhs);
+  }
+
+ private:
+  template <class, class>
+  friend class indexed_iterator;
+
+  owner_type* __owner = nullptr;
+  size_type __index = 0;
+};
+}  // namespace s21
+
+#endif  // S21_INDEXED_ITERATOR_H
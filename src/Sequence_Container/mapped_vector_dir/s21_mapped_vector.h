@@ -0,0 +1,382 @@
+#ifndef S21_MAPPED_VECTOR_H
+#define S21_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace s21 {
+// Вектор тривиально копируемых записей, который хранится в файле,
+// отображенном в память. Файл - это просто массив записей без заголовка:
+// при открытии size() равен длине файла, деленной на sizeof(T), и данные
+// подгружаются системой по мере обращения к ним. Файл, длина которого не
+// кратна sizeof(T), не открывается.
+// Между вызовами sync() файл имеет длину capacity() записей, а sync() и
+// close() обрезают его до size(). Поэтому после sync() файл в точности
+// совпадает с вектором, даже если программа потом аварийно завершится
+template <class T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable records can be mapped");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  // Подсказки для advise
+  enum class access { normal, sequential, random, willneed, dontneed };
+
+  // Конструктор, который открывает файл, а если его нет - создает пустой
+  explicit mapped_vector(const std::string& path);
+  mapped_vector(const mapped_vector&) = delete;
+  mapped_vector(mapped_vector&& v) noexcept;
+  ~mapped_vector();
+  mapped_vector& operator=(const mapped_vector&) = delete;
+  mapped_vector& operator=(mapped_vector&& v) noexcept;
+
+  reference at(size_type i);
+  reference operator[](size_type i) noexcept;
+  const_reference operator[](size_type i) const noexcept;
+  reference front() noexcept;
+  reference back() noexcept;
+  T* data() noexcept;
+  const T* data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  // Этот метод удлиняет файл до new_capacity записей и отображает его заново
+  void reserve(size_type new_capacity);
+  // Этот метод обрезает файл до size() записей
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  void pop_back() noexcept;
+  void resize(size_type n);
+  void swap(mapped_vector& other) noexcept;
+
+  // Этот метод обрезает файл до size() записей, записывает измененные
+  // страницы и ждет завершения
+  void sync();
+  // Этот метод сообщает системе, как будут читаться данные
+  void advise(access hint);
+  // Этот метод обрезает файл до size() записей и закрывает его. Если
+  // обрезать не удалось, файл все равно закрывается, а ошибка
+  // пробрасывается
+  void close();
+
+ private:
+  int __fd;
+  size_type __size, __capacity;
+  iterator __data;
+
+  // Меняет длину файла и отображения на new_capacity записей. Если
+  // отобразить не удалось, длина файла и отображение остаются прежними
+  void __remap(size_type new_capacity);
+};
+}  // namespace s21
+
+/*
+  КОНСТРУКТОРЫ И ДЕСТРУКТОР
+*/
+
+template <class T>
+s21::mapped_vector<T>::mapped_vector(const std::string& path)
+    : __fd{::open(path.c_str(), O_RDWR | O_CREAT, 0644)},
+      __size{0},
+      __capacity{0},
+      __data{nullptr} {
+  if (__fd < 0) throw std::runtime_error("Cannot open file " + path);
+  struct stat info;
+  if (::fstat(__fd, &info) != 0) {
+    ::close(__fd);
+    throw std::runtime_error("Cannot stat file " + path);
+  }
+  size_type count = static_cast<size_type>(info.st_size) / sizeof(T);
+  if (static_cast<size_type>(info.st_size) % sizeof(T) != 0) {
+    ::close(__fd);
+    throw std::runtime_error("Partial record at the end of file " + path);
+  }
+  try {
+    __remap(count);
+  } catch (...) {
+    ::close(__fd);
+    throw;
+  }
+  __size = count;
+}
+
+template <class T>
+s21::mapped_vector<T>::mapped_vector(mapped_vector&& v) noexcept
+    : __fd{v.__fd},
+      __size{v.__size},
+      __capacity{v.__capacity},
+      __data{v.__data} {
+  v.__fd = -1;
+  v.__size = v.__capacity = 0;
+  v.__data = nullptr;
+}
+
+template <class T>
+s21::mapped_vector<T>::~mapped_vector() {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+template <class T>
+s21::mapped_vector<T>& s21::mapped_vector<T>::operator=(
+    mapped_vector&& v) noexcept {
+  if (this != &v) {
+    mapped_vector buf(std::move(v));
+    swap(buf);
+  }
+  return *this;
+}
+
+/*
+  ДОСТУП К ЭЛЕМЕНТАМ
+*/
+
+template <class T>
+T& s21::mapped_vector<T>::at(size_type i) {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return __data[i];
+}
+
+template <class T>
+T& s21::mapped_vector<T>::operator[](size_type i) noexcept {
+  return __data[i];
+}
+
+template <class T>
+const T& s21::mapped_vector<T>::operator[](size_type i) const noexcept {
+  return __data[i];
+}
+
+template <class T>
+T& s21::mapped_vector<T>::front() noexcept {
+  return __data[0];
+}
+
+template <class T>
+T& s21::mapped_vector<T>::back() noexcept {
+  return __data[__size - 1];
+}
+
+template <class T>
+T* s21::mapped_vector<T>::data() noexcept {
+  return __data;
+}
+
+template <class T>
+const T* s21::mapped_vector<T>::data() const noexcept {
+  return __data;
+}
+
+/*
+  ИТЕРАТОРЫ
+*/
+
+template <class T>
+T* s21::mapped_vector<T>::begin() noexcept {
+  return __data;
+}
+
+template <class T>
+const T* s21::mapped_vector<T>::begin() const noexcept {
+  return __data;
+}
+
+template <class T>
+T* s21::mapped_vector<T>::end() noexcept {
+  return __data + __size;
+}
+
+template <class T>
+const T* s21::mapped_vector<T>::end() const noexcept {
+  return __data + __size;
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <class T>
+bool s21::mapped_vector<T>::empty() const noexcept {
+  return __size == 0;
+}
+
+template <class T>
+size_t s21::mapped_vector<T>::size() const noexcept {
+  return __size;
+}
+
+template <class T>
+size_t s21::mapped_vector<T>::capacity() const noexcept {
+  return __capacity;
+}
+
+template <class T>
+void s21::mapped_vector<T>::reserve(size_type new_capacity) {
+  if (new_capacity > __capacity) __remap(new_capacity);
+}
+
+template <class T>
+void s21::mapped_vector<T>::shrink_to_fit() {
+  if (__size < __capacity) __remap(__size);
+}
+
+/*
+  ИЗМЕНЕНИЕ КОНТЕЙНЕРА
+*/
+
+template <class T>
+void s21::mapped_vector<T>::clear() noexcept {
+  __size = 0;
+}
+
+template <class T>
+void s21::mapped_vector<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class T>
+template <class... Args>
+T& s21::mapped_vector<T>::emplace_back(Args&&... args) {
+  // Аргументы могут ссылаться на запись, а отображение может переехать
+  value_type buf(std::forward<Args>(args)...);
+  if (__size == __capacity) __remap(std::max<size_type>(__capacity * 2, 1));
+  __data[__size] = buf;
+  return __data[__size++];
+}
+
+template <class T>
+void s21::mapped_vector<T>::pop_back() noexcept {
+  --__size;
+}
+
+template <class T>
+void s21::mapped_vector<T>::resize(size_type n) {
+  reserve(n);
+  // Новые места файла уже заполнены нулями, старые могли остаться от
+  // удаленных записей
+  if (n > __size) std::fill(end(), begin() + n, value_type());
+  __size = n;
+}
+
+template <class T>
+void s21::mapped_vector<T>::swap(mapped_vector& other) noexcept {
+  std::swap(__fd, other.__fd);
+  std::swap(__size, other.__size);
+  std::swap(__capacity, other.__capacity);
+  std::swap(__data, other.__data);
+}
+
+/*
+  РАБОТА С ФАЙЛОМ
+*/
+
+template <class T>
+void s21::mapped_vector<T>::sync() {
+  shrink_to_fit();
+  if (__data != nullptr &&
+      ::msync(__data, __capacity * sizeof(T), MS_SYNC) != 0) {
+    throw std::runtime_error("Cannot sync mapped file");
+  }
+}
+
+template <class T>
+void s21::mapped_vector<T>::advise(access hint) {
+  static const int kAdvice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM,
+                                MADV_WILLNEED, MADV_DONTNEED};
+  if (__data != nullptr &&
+      ::madvise(__data, __capacity * sizeof(T),
+                kAdvice[static_cast<int>(hint)]) != 0) {
+    throw std::runtime_error("Cannot advise mapped file");
+  }
+}
+
+template <class T>
+void s21::mapped_vector<T>::close() {
+  if (__fd >= 0) {
+    std::exception_ptr error;
+    try {
+      shrink_to_fit();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    // __remap поддерживает __data и __capacity в согласии с отображением
+    // и при ошибке, так что освободить его можно в любом случае
+    if (__data != nullptr) ::munmap(__data, __capacity * sizeof(T));
+    ::close(__fd);
+    __fd = -1;
+    __size = __capacity = 0;
+    __data = nullptr;
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+template <class T>
+void s21::mapped_vector<T>::__remap(size_type new_capacity) {
+  size_type old_bytes = __capacity * sizeof(T);
+  size_type new_bytes = new_capacity * sizeof(T);
+  // Отображение нельзя оставлять длиннее файла: обращение за его конец
+  // приводит к SIGBUS, поэтому при уменьшении файл обрезается последним
+  if (new_bytes > old_bytes &&
+      ::ftruncate(__fd, static_cast<off_t>(new_bytes)) != 0) {
+    throw std::runtime_error("Cannot extend mapped file");
+  }
+  void* address = nullptr;
+  if (__data != nullptr && new_bytes != 0) {
+#ifdef __linux__
+    address = ::mremap(__data, old_bytes, new_bytes, MREMAP_MAYMOVE);
+#else
+    address = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     __fd, 0);
+    if (address != MAP_FAILED) ::munmap(__data, old_bytes);
+#endif
+  } else if (new_bytes != 0) {
+    address = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     __fd, 0);
+  } else if (__data != nullptr) {
+    ::munmap(__data, old_bytes);
+  }
+  // Если отобразить не удалось, старое отображение остается в силе, а
+  // файл возвращается к прежней длине
+  if (address == MAP_FAILED) {
+    if (new_bytes > old_bytes &&
+        ::ftruncate(__fd, static_cast<off_t>(old_bytes)) != 0) {
+      throw std::runtime_error("Cannot map file nor restore its length");
+    }
+    throw std::runtime_error("Cannot map file");
+  }
+  __data = static_cast<iterator>(address);
+  __capacity = new_capacity;
+  if (new_bytes < old_bytes &&
+      ::ftruncate(__fd, static_cast<off_t>(new_bytes)) != 0) {
+    throw std::runtime_error("Cannot truncate mapped file");
+  }
+}
+
+#endif  // S21_MAPPED_VECTOR_H
@@ -0,0 +1,413 @@
+#ifndef S21_RING_DEQUE_H
+#define S21_RING_DEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../Additional_Container/span_dir/s21_span.h"
+#include "../indexed_iterator.h"
+
+namespace s21 {
+// Двусторонняя очередь в одном кольцевом буфере. Емкость - степень двойки,
+// поэтому позиция элемента i - это (head + i) & (capacity - 1). Когда буфер
+// заполнен, он удваивается, а элементы переносятся в начало нового буфера
+// по порядку. Содержимое кольца - это не больше двух непрерывных кусков,
+// segments() возвращает их для массового чтения и записи.
+// Подходит как Container для s21::queue и s21::stack
+template <class T>
+class ring_deque {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = indexed_iterator<ring_deque, T>;
+  using const_iterator = indexed_iterator<ring_deque, const T>;
+  using size_type = size_t;
+
+  ring_deque() noexcept;
+  ring_deque(std::initializer_list<value_type> const& items);
+  ring_deque(const ring_deque& d);
+  ring_deque(ring_deque&& d) noexcept;
+  ~ring_deque();
+  ring_deque& operator=(const ring_deque& d);
+  ring_deque& operator=(ring_deque&& d) noexcept;
+
+  reference at(size_type i);
+  const_reference at(size_type i) const;
+  reference operator[](size_type i) noexcept;
+  const_reference operator[](size_type i) const noexcept;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  // Этот метод возвращает элементы двумя непрерывными кусками: от head до
+  // конца буфера и от начала буфера. Второй кусок пуст, если кольцо не
+  // переходит через конец буфера
+  std::pair<span<T>, span<T>> segments() noexcept;
+  std::pair<span<const T>, span<const T>> segments() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  // Этот метод увеличивает емкость до степени двойки не меньше new_capacity
+  void reserve(size_type new_capacity);
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  void push_front(const_reference value);
+  void push_front(value_type&& value);
+  template <class... Args>
+  reference emplace_front(Args&&... args);
+  // Эти методы ничего не делают, если очередь пуста, как у s21::deque
+  void pop_back() noexcept;
+  void pop_front() noexcept;
+  void swap(ring_deque& other) noexcept;
+
+ private:
+  T* __data;
+  size_type __capacity, __head, __size;
+
+  // Возвращает адрес элемента i
+  T* __slot(size_type i) const noexcept;
+  // Вызывает деструкторы элементов [first, last)
+  static void __destroy(T* first, T* last) noexcept;
+  // Переносит элементы в новый буфер емкостью new_capacity по порядку,
+  // начиная с его начала
+  void __relocate(size_type new_capacity);
+  // Освобождает буфер, элементов в нем уже нет
+  void __release() noexcept;
+};
+}  // namespace s21
+
+/*
+  КОНСТРУКТОРЫ И ДЕСТРУКТОР
+*/
+
+template <class T>
+s21::ring_deque<T>::ring_deque() noexcept
+    : __data{nullptr}, __capacity{0}, __head{0}, __size{0} {}
+
+template <class T>
+s21::ring_deque<T>::ring_deque(std::initializer_list<value_type> const& items)
+    : ring_deque() {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T>
+s21::ring_deque<T>::ring_deque(const ring_deque& d) : ring_deque() {
+  reserve(d.size());
+  for (const_reference item : d) push_back(item);
+}
+
+template <class T>
+s21::ring_deque<T>::ring_deque(ring_deque&& d) noexcept : ring_deque() {
+  swap(d);
+}
+
+template <class T>
+s21::ring_deque<T>::~ring_deque() {
+  clear();
+  __release();
+}
+
+template <class T>
+s21::ring_deque<T>& s21::ring_deque<T>::operator=(const ring_deque& d) {
+  if (this != &d) {
+    clear();
+    reserve(d.size());
+    for (const_reference item : d) push_back(item);
+  }
+  return *this;
+}
+
+template <class T>
+s21::ring_deque<T>& s21::ring_deque<T>::operator=(ring_deque&& d) noexcept {
+  if (this != &d) {
+    clear();
+    __release();
+    swap(d);
+  }
+  return *this;
+}
+
+/*
+  ДОСТУП К ЭЛЕМЕНТАМ
+*/
+
+template <class T>
+T& s21::ring_deque<T>::at(size_type i) {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return *__slot(i);
+}
+
+template <class T>
+const T& s21::ring_deque<T>::at(size_type i) const {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return *__slot(i);
+}
+
+template <class T>
+T& s21::ring_deque<T>::operator[](size_type i) noexcept {
+  return *__slot(i);
+}
+
+template <class T>
+const T& s21::ring_deque<T>::operator[](size_type i) const noexcept {
+  return *__slot(i);
+}
+
+template <class T>
+T& s21::ring_deque<T>::front() noexcept {
+  return *__slot(0);
+}
+
+template <class T>
+const T& s21::ring_deque<T>::front() const noexcept {
+  return *__slot(0);
+}
+
+template <class T>
+T& s21::ring_deque<T>::back() noexcept {
+  return *__slot(__size - 1);
+}
+
+template <class T>
+const T& s21::ring_deque<T>::back() const noexcept {
+  return *__slot(__size - 1);
+}
+
+template <class T>
+std::pair<s21::span<T>, s21::span<T>>
+s21::ring_deque<T>::segments() noexcept {
+  size_type first = std::min(__size, __capacity - __head);
+  return {span<T>(__data + __head, first),
+          span<T>(__data, __size - first)};
+}
+
+template <class T>
+std::pair<s21::span<const T>, s21::span<const T>>
+s21::ring_deque<T>::segments() const noexcept {
+  size_type first = std::min(__size, __capacity - __head);
+  return {span<const T>(__data + __head, first),
+          span<const T>(__data, __size - first)};
+}
+
+/*
+  ИТЕРАТОРЫ
+*/
+
+template <class T>
+typename s21::ring_deque<T>::iterator s21::ring_deque<T>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class T>
+typename s21::ring_deque<T>::const_iterator s21::ring_deque<T>::begin()
+    const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class T>
+typename s21::ring_deque<T>::iterator s21::ring_deque<T>::end() noexcept {
+  return iterator(this, __size);
+}
+
+template <class T>
+typename s21::ring_deque<T>::const_iterator s21::ring_deque<T>::end()
+    const noexcept {
+  return const_iterator(this, __size);
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <class T>
+bool s21::ring_deque<T>::empty() const noexcept {
+  return __size == 0;
+}
+
+template <class T>
+size_t s21::ring_deque<T>::size() const noexcept {
+  return __size;
+}
+
+template <class T>
+size_t s21::ring_deque<T>::capacity() const noexcept {
+  return __capacity;
+}
+
+template <class T>
+void s21::ring_deque<T>::reserve(size_type new_capacity) {
+  if (new_capacity > __capacity) {
+    size_type rounded = std::max<size_type>(__capacity, 8);
+    while (rounded < new_capacity) rounded *= 2;
+    __relocate(rounded);
+  }
+}
+
+/*
+  ИЗМЕНЕНИЕ КОНТЕЙНЕРА
+*/
+
+template <class T>
+void s21::ring_deque<T>::clear() noexcept {
+  std::pair<span<T>, span<T>> parts = segments();
+  __destroy(parts.first.begin(), parts.first.end());
+  __destroy(parts.second.begin(), parts.second.end());
+  __head = __size = 0;
+}
+
+template <class T>
+void s21::ring_deque<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class T>
+void s21::ring_deque<T>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+T& s21::ring_deque<T>::emplace_back(Args&&... args) {
+  if (__size == __capacity) {
+    // Аргументы могут ссылаться на элемент, который сейчас переедет
+    value_type buf(std::forward<Args>(args)...);
+    reserve(__capacity + 1);
+    new (__slot(__size)) value_type(std::move(buf));
+  } else {
+    new (__slot(__size)) value_type(std::forward<Args>(args)...);
+  }
+  return *__slot(__size++);
+}
+
+template <class T>
+void s21::ring_deque<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <class T>
+void s21::ring_deque<T>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+T& s21::ring_deque<T>::emplace_front(Args&&... args) {
+  if (__size == __capacity) {
+    value_type buf(std::forward<Args>(args)...);
+    reserve(__capacity + 1);
+    new (__slot(__capacity - 1)) value_type(std::move(buf));
+  } else {
+    new (__slot(__capacity - 1)) value_type(std::forward<Args>(args)...);
+  }
+  // Элемент с номером capacity - 1 стоит в буфере прямо перед head
+  __head = (__head + __capacity - 1) & (__capacity - 1);
+  ++__size;
+  return *__slot(0);
+}
+
+template <class T>
+void s21::ring_deque<T>::pop_back() noexcept {
+  if (__size != 0) {
+    T* place = __slot(--__size);
+    __destroy(place, place + 1);
+  }
+}
+
+template <class T>
+void s21::ring_deque<T>::pop_front() noexcept {
+  if (__size != 0) {
+    T* place = __slot(0);
+    __destroy(place, place + 1);
+    __head = (__head + 1) & (__capacity - 1);
+    --__size;
+  }
+}
+
+template <class T>
+void s21::ring_deque<T>::swap(ring_deque& other) noexcept {
+  std::swap(__data, other.__data);
+  std::swap(__capacity, other.__capacity);
+  std::swap(__head, other.__head);
+  std::swap(__size, other.__size);
+}
+
+/*
+  ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
+*/
+
+template <class T>
+T* s21::ring_deque<T>::__slot(size_type i) const noexcept {
+  return __data + ((__head + i) & (__capacity - 1));
+}
+
+template <class T>
+void s21::ring_deque<T>::__destroy(T* first, T* last) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (; first != last; ++first) first->~value_type();
+  }
+}
+
+template <class T>
+void s21::ring_deque<T>::__relocate(size_type new_capacity) {
+  T* new_data = std::allocator<value_type>().allocate(new_capacity);
+  std::pair<span<T>, span<T>> parts = segments();
+  T* out = new_data;
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    for (span<T> part : {parts.first, parts.second}) {
+      if (!part.empty())
+        std::memcpy(static_cast<void*>(out), part.data(), part.size_bytes());
+      out += part.size();
+    }
+  } else {
+    // Если копирующий конструктор бросит исключение, старый буфер еще цел:
+    // уничтожается только то, что успело появиться в новом
+    try {
+      for (span<T> part : {parts.first, parts.second}) {
+        for (T& item : part) {
+          new (out) value_type(std::move_if_noexcept(item));
+          ++out;
+        }
+      }
+    } catch (...) {
+      __destroy(new_data, out);
+      std::allocator<value_type>().deallocate(new_data, new_capacity);
+      throw;
+    }
+    __destroy(parts.first.begin(), parts.first.end());
+    __destroy(parts.second.begin(), parts.second.end());
+  }
+  __release();
+  __data = new_data;
+  __capacity = new_capacity;
+  __head = 0;
+}
+
+template <class T>
+void s21::ring_deque<T>::__release() noexcept {
+  if (__data != nullptr)
+    std::allocator<value_type>().deallocate(__data, __capacity);
+  __data = nullptr;
+  __capacity = 0;
+}
+
+#endif  // S21_RING_DEQUE_H
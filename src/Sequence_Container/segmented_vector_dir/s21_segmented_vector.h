@@ -0,0 +1,523 @@
+#ifndef S21_SEGMENTED_VECTOR_H
+#define S21_SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../Additional_Container/span_dir/s21_span.h"
+
+namespace s21 {
+// Вектор, который никогда не переносит элементы. Память выделяется
+// сегментами: первый вмещает First элементов, каждый следующий вдвое больше
+// предыдущего. При росте добавляется новый сегмент, а старые остаются
+// на месте, поэтому указатели и ссылки на элементы живут до их удаления.
+// Номер сегмента по индексу вычисляется через старший бит, то есть за O(1).
+// Сегменты - это непрерывные куски, их можно обходить через chunk().
+// Таблица сегментов лежит в куче и переходит вместе с ними при swap и
+// перемещении, поэтому итераторы после них остаются действительными и
+// указывают на те же элементы уже в другом векторе
+template <class T, size_t First = 16>
+class segmented_vector {
+  static_assert(First > 0 && (First & (First - 1)) == 0,
+                "First segment size must be a power of two");
+  static_assert(First <= (size_t{1} << 15), "First segment is too large");
+
+ public:
+  template <class Value>
+  class basic_iterator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = basic_iterator<T>;
+  using const_iterator = basic_iterator<const T>;
+  using size_type = size_t;
+
+  segmented_vector() noexcept;
+  explicit segmented_vector(size_type n);
+  segmented_vector(std::initializer_list<value_type> const& items);
+  segmented_vector(const segmented_vector& v);
+  segmented_vector(segmented_vector&& v) noexcept;
+  ~segmented_vector();
+  segmented_vector& operator=(const segmented_vector& v);
+  segmented_vector& operator=(segmented_vector&& v) noexcept;
+
+  reference at(size_type i);
+  const_reference at(size_type i) const;
+  reference operator[](size_type i) noexcept;
+  const_reference operator[](size_type i) const noexcept;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  // Этот метод возвращает количество сегментов, в которых есть элементы
+  size_type chunk_count() const noexcept;
+  // Этот метод возвращает элементы сегмента k одним непрерывным куском
+  span<T> chunk(size_type k) noexcept;
+  span<const T> chunk(size_type k) const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  // Этот метод выделяет сегменты, пока емкость меньше new_capacity
+  void reserve(size_type new_capacity);
+  // Этот метод освобождает сегменты, в которых нет элементов
+  void shrink_to_fit() noexcept;
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  void pop_back() noexcept;
+  void resize(size_type n);
+  void swap(segmented_vector& other) noexcept;
+
+  // Итератор с произвольным доступом: хранит таблицу сегментов и индекс.
+  // Таблица не принадлежит объекту вектора, поэтому переживает swap
+  template <class Value>
+  class basic_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    basic_iterator() = default;
+    basic_iterator(T* const* segments, size_type index)
+        : __segments(segments), __index(index) {}
+    // iterator приводится к const_iterator
+    template <class Other, class = std::enable_if_t<
+                               std::is_convertible_v<Other*, Value*>>>
+    basic_iterator(const basic_iterator<Other>& other)
+        : __segments(other.__segments), __index(other.__index) {}
+
+    reference operator*() const { return *__locate(__segments, __index); }
+    pointer operator->() const { return __locate(__segments, __index); }
+    reference operator[](difference_type n) const {
+      return *__locate(__segments, __index + n);
+    }
+
+    basic_iterator& operator++() {
+      ++__index;
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator buf(*this);
+      ++__index;
+      return buf;
+    }
+    basic_iterator& operator--() {
+      --__index;
+      return *this;
+    }
+    basic_iterator operator--(int) {
+      basic_iterator buf(*this);
+      --__index;
+      return buf;
+    }
+    basic_iterator& operator+=(difference_type n) {
+      __index += n;
+      return *this;
+    }
+    basic_iterator& operator-=(difference_type n) {
+      __index -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const {
+      return basic_iterator(__segments, __index + n);
+    }
+    basic_iterator operator-(difference_type n) const {
+      return basic_iterator(__segments, __index - n);
+    }
+    difference_type operator-(const basic_iterator& other) const {
+      return static_cast<difference_type>(__index - other.__index);
+    }
+
+    bool operator==(const basic_iterator& other) const {
+      return __index == other.__index;
+    }
+    bool operator!=(const basic_iterator& other) const {
+      return __index != other.__index;
+    }
+    bool operator<(const basic_iterator& other) const {
+      return __index < other.__index;
+    }
+    bool operator>(const basic_iterator& other) const {
+      return other < *this;
+    }
+    bool operator<=(const basic_iterator& other) const {
+      return !(other < *this);
+    }
+    bool operator>=(const basic_iterator& other) const {
+      return !(*this < other);
+    }
+
+   private:
+    template <class>
+    friend class basic_iterator;
+
+    T* const* __segments = nullptr;
+    size_type __index = 0;
+  };
+
+ private:
+  // 48 сегментов вмещают First * (2^48 - 1) элементов, это больше
+  // адресного пространства
+  static constexpr size_type kMaxSegments = 48;
+
+  // Таблица на kMaxSegments указателей, выделяется вместе с первым
+  // сегментом
+  T** __segments;
+  size_type __size, __segment_count;
+
+  // Возвращает номер сегмента, в котором лежит элемент i
+  static size_type __segment_of(size_type i) noexcept;
+  // Возвращает индекс первого элемента сегмента k
+  static size_type __segment_begin(size_type k) noexcept;
+  // Возвращает емкость сегмента k
+  static size_type __segment_size(size_type k) noexcept;
+  // Возвращает адрес элемента i
+  static T* __locate(T* const* segments, size_type i) noexcept;
+  // Вызывает деструкторы элементов [first, last)
+  static void __destroy(T* first, T* last) noexcept;
+  // Добавляет новый сегмент в конец таблицы
+  void __grow();
+  // Освобождает сегменты, начиная с from
+  void __release(size_type from) noexcept;
+  // Забирает сегменты вектора v, v остается пустым
+  void __steal(segmented_vector& v) noexcept;
+};
+}  // namespace s21
+
+/*
+  КОНСТРУКТОРЫ И ДЕСТРУКТОР
+*/
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::segmented_vector() noexcept
+    : __segments{nullptr}, __size{0}, __segment_count{0} {}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::segmented_vector(size_type n)
+    : segmented_vector() {
+  resize(n);
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::segmented_vector(
+    std::initializer_list<value_type> const& items)
+    : segmented_vector() {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::segmented_vector(const segmented_vector& v)
+    : segmented_vector() {
+  reserve(v.size());
+  for (size_type k = 0; k < v.chunk_count(); ++k)
+    for (const_reference item : v.chunk(k)) push_back(item);
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::segmented_vector(
+    segmented_vector&& v) noexcept
+    : segmented_vector() {
+  __steal(v);
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>::~segmented_vector() {
+  clear();
+  __release(0);
+  delete[] __segments;
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>& s21::segmented_vector<T, First>::operator=(
+    const segmented_vector& v) {
+  if (this != &v) {
+    // Свои сегменты используются повторно, новые выделяются только при
+    // нехватке места
+    clear();
+    reserve(v.size());
+    for (size_type k = 0; k < v.chunk_count(); ++k)
+      for (const_reference item : v.chunk(k)) push_back(item);
+  }
+  return *this;
+}
+
+template <class T, size_t First>
+s21::segmented_vector<T, First>& s21::segmented_vector<T, First>::operator=(
+    segmented_vector&& v) noexcept {
+  if (this != &v) {
+    clear();
+    __release(0);
+    __steal(v);
+  }
+  return *this;
+}
+
+/*
+  ДОСТУП К ЭЛЕМЕНТАМ
+*/
+
+template <class T, size_t First>
+T& s21::segmented_vector<T, First>::at(size_type i) {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return (*this)[i];
+}
+
+template <class T, size_t First>
+const T& s21::segmented_vector<T, First>::at(size_type i) const {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return (*this)[i];
+}
+
+template <class T, size_t First>
+T& s21::segmented_vector<T, First>::operator[](size_type i) noexcept {
+  return *__locate(__segments, i);
+}
+
+template <class T, size_t First>
+const T& s21::segmented_vector<T, First>::operator[](
+    size_type i) const noexcept {
+  return *__locate(__segments, i);
+}
+
+template <class T, size_t First>
+T& s21::segmented_vector<T, First>::front() noexcept {
+  return __segments[0][0];
+}
+
+template <class T, size_t First>
+const T& s21::segmented_vector<T, First>::front() const noexcept {
+  return __segments[0][0];
+}
+
+template <class T, size_t First>
+T& s21::segmented_vector<T, First>::back() noexcept {
+  return (*this)[__size - 1];
+}
+
+template <class T, size_t First>
+const T& s21::segmented_vector<T, First>::back() const noexcept {
+  return (*this)[__size - 1];
+}
+
+/*
+  ИТЕРАТОРЫ
+*/
+
+template <class T, size_t First>
+typename s21::segmented_vector<T, First>::iterator
+s21::segmented_vector<T, First>::begin() noexcept {
+  return iterator(__segments, 0);
+}
+
+template <class T, size_t First>
+typename s21::segmented_vector<T, First>::const_iterator
+s21::segmented_vector<T, First>::begin() const noexcept {
+  return const_iterator(__segments, 0);
+}
+
+template <class T, size_t First>
+typename s21::segmented_vector<T, First>::iterator
+s21::segmented_vector<T, First>::end() noexcept {
+  return iterator(__segments, __size);
+}
+
+template <class T, size_t First>
+typename s21::segmented_vector<T, First>::const_iterator
+s21::segmented_vector<T, First>::end() const noexcept {
+  return const_iterator(__segments, __size);
+}
+
+/*
+  СЕГМЕНТЫ
+*/
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::chunk_count() const noexcept {
+  return __size == 0 ? 0 : __segment_of(__size - 1) + 1;
+}
+
+template <class T, size_t First>
+s21::span<T> s21::segmented_vector<T, First>::chunk(size_type k) noexcept {
+  size_type count = std::min(__segment_size(k), __size - __segment_begin(k));
+  return span<T>(__segments[k], count);
+}
+
+template <class T, size_t First>
+s21::span<const T> s21::segmented_vector<T, First>::chunk(
+    size_type k) const noexcept {
+  size_type count = std::min(__segment_size(k), __size - __segment_begin(k));
+  return span<const T>(__segments[k], count);
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <class T, size_t First>
+bool s21::segmented_vector<T, First>::empty() const noexcept {
+  return __size == 0;
+}
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::size() const noexcept {
+  return __size;
+}
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::capacity() const noexcept {
+  return __segment_begin(__segment_count);
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::reserve(size_type new_capacity) {
+  while (capacity() < new_capacity) __grow();
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::shrink_to_fit() noexcept {
+  __release(chunk_count());
+}
+
+/*
+  ИЗМЕНЕНИЕ КОНТЕЙНЕРА
+*/
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::clear() noexcept {
+  for (size_type k = 0; k < chunk_count(); ++k) {
+    span<T> items = chunk(k);
+    __destroy(items.begin(), items.end());
+  }
+  __size = 0;
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <class T, size_t First>
+template <class... Args>
+T& s21::segmented_vector<T, First>::emplace_back(Args&&... args) {
+  // Старые элементы не переезжают, поэтому аргументы, ссылающиеся на них,
+  // остаются действительными и копировать их заранее не нужно
+  if (__size == capacity()) __grow();
+  T* place = __locate(__segments, __size);
+  new (place) value_type(std::forward<Args>(args)...);
+  ++__size;
+  return *place;
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::pop_back() noexcept {
+  --__size;
+  T* place = __locate(__segments, __size);
+  __destroy(place, place + 1);
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::resize(size_type n) {
+  reserve(n);
+  while (__size > n) pop_back();
+  while (__size < n) emplace_back();
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::swap(segmented_vector& other) noexcept {
+  std::swap(__segments, other.__segments);
+  std::swap(__size, other.__size);
+  std::swap(__segment_count, other.__segment_count);
+}
+
+/*
+  ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
+*/
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::__segment_of(size_type i) noexcept {
+  // У элементов сегмента k число i / First + 1 лежит в [2^k, 2^(k + 1)),
+  // так что номер сегмента - это номер его старшего бита. First - степень
+  // двойки, поэтому деление компилируется в сдвиг
+  size_type j = i / First + 1;
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - static_cast<size_type>(__builtin_clzll(j));
+#else
+  size_type result = 0;
+  while (j >>= 1) ++result;
+  return result;
+#endif
+}
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::__segment_begin(
+    size_type k) noexcept {
+  return (First << k) - First;
+}
+
+template <class T, size_t First>
+size_t s21::segmented_vector<T, First>::__segment_size(size_type k) noexcept {
+  return First << k;
+}
+
+template <class T, size_t First>
+T* s21::segmented_vector<T, First>::__locate(T* const* segments,
+                                             size_type i) noexcept {
+  size_type k = __segment_of(i);
+  return segments[k] + (i - __segment_begin(k));
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::__destroy(T* first, T* last) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (; first != last; ++first) first->~value_type();
+  }
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::__grow() {
+  if (__segment_count == kMaxSegments) throw std::length_error("Too long");
+  if (__segments == nullptr) __segments = new T*[kMaxSegments]();
+  __segments[__segment_count] =
+      std::allocator<value_type>().allocate(__segment_size(__segment_count));
+  ++__segment_count;
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::__release(size_type from) noexcept {
+  for (; __segment_count > from; --__segment_count) {
+    size_type k = __segment_count - 1;
+    std::allocator<value_type>().deallocate(__segments[k], __segment_size(k));
+    __segments[k] = nullptr;
+  }
+}
+
+template <class T, size_t First>
+void s21::segmented_vector<T, First>::__steal(segmented_vector& v) noexcept {
+  swap(v);
+}
+
+#endif  // S21_SEGMENTED_VECTOR_H
@@ -1,6 +1,12 @@
 #ifndef S21_CONTAINERS_SEQUENCE_CONTAINER_H
 #define S21_CONTAINERS_SEQUENCE_CONTAINER_H
+#include "bit_vector_dir/s21_bit_vector.h"
 #include "deque_dir/s21_deque.h"
 #include "list_dir/s21_list.h"
+#include "mapped_vector_dir/s21_mapped_vector.h"
+#include "ring_deque_dir/s21_ring_deque.h"
+#include "segmented_vector_dir/s21_segmented_vector.h"
+#include "small_vector_dir/s21_small_vector.h"
+#include "soa_vector_dir/s21_soa_vector.h"
 #include "vector_dir/s21_vector.h"
 #endif  // end S21_CONTAINERS_SEQUENCE_CONTAINER_H
\ No newline at end of file
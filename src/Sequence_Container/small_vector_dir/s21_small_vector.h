@@ -0,0 +1,514 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector_dir/relocation.h"
+
+namespace s21 {
+// Вектор, который хранит до N элементов внутри самого объекта и выделяет
+// память в куче, только когда элементов становится больше. Интерфейс такой
+// же, как у s21::vector
+template <class T, size_t N>
+class small_vector {
+  static_assert(N > 0, "Inline capacity must be positive");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  small_vector() noexcept;
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const& items);
+  small_vector(const small_vector& v);
+  small_vector(small_vector&& v) noexcept;
+  ~small_vector();
+  small_vector& operator=(const small_vector& v);
+  small_vector& operator=(small_vector&& v) noexcept;
+
+  reference at(size_type i);
+  const_reference at(size_type i) const;
+  reference operator[](size_type i) noexcept;
+  const_reference operator[](size_type i) const noexcept;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  T* data() noexcept;
+  const T* data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_capacity);
+  size_type capacity() const noexcept;
+  // Этот метод освобождает лишнюю память. Если элементы помещаются во
+  // внутренний буфер, то они переносятся туда
+  void shrink_to_fit();
+  // Этот метод проверяет, лежат ли элементы во внутреннем буфере
+  bool is_inline() const noexcept;
+
+  void clear() noexcept;
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, size_type n, const_reference value);
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <class... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  void pop_back() noexcept;
+  void swap(small_vector& other) noexcept;
+
+ private:
+  // Память в куче и создание элементов идут через этот аллокатор, общие с
+  // s21::vector функции из relocation.h получают его по ссылке
+  inline static std::allocator<value_type> __alloc{};
+
+  size_type __size, __capacity;
+  iterator __data;
+  alignas(T) unsigned char __buffer[N * sizeof(T)];
+
+  // Возвращает начало внутреннего буфера
+  iterator __inline_data() noexcept;
+  // Переносит элементы в буфер емкостью new_capacity. Если она не больше N,
+  // то используется внутренний буфер
+  void __relocate(size_type new_capacity);
+  // То же, но оставляет перед позицией pos count свободных мест, которые
+  // fill заполняет до переноса старых элементов
+  template <class Fill>
+  void __relocate(size_type new_capacity, size_type pos, size_type count,
+                  Fill fill);
+  // Освобождает память в куче и возвращается к внутреннему буферу
+  void __release() noexcept;
+  // Забирает элементы пустого вектора v. Память в куче передается без
+  // копирования, элементы из внутреннего буфера переносятся по одному
+  void __steal(small_vector& v) noexcept;
+  // Вставляет count элементов перед pos, при необходимости увеличивая
+  // емкость. fill создает их на пустых местах
+  template <class Fill>
+  iterator __insert_gap(size_type pos, size_type count, Fill fill);
+};
+
+template <class T, size_t N>
+bool operator==(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, size_t N>
+bool operator!=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, size_t N>
+bool operator<(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end());
+}
+
+template <class T, size_t N>
+bool operator<=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class T, size_t N>
+bool operator>(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, size_t N>
+bool operator>=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs) {
+  return !(lhs < rhs);
+}
+}  // namespace s21
+
+/*
+  КОНСТРУКТОРЫ И ДЕСТРУКТОР
+*/
+
+template <class T, size_t N>
+s21::small_vector<T, N>::small_vector() noexcept
+    : __size{0}, __capacity{N}, __data{__inline_data()} {}
+
+template <class T, size_t N>
+s21::small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  reserve(n);
+  try {
+    s21::__construct_range(__alloc, __data, n,
+                           [](iterator p, size_type) { new (p) value_type(); });
+  } catch (...) {
+    // Деструктор недостроенного объекта не вызывается
+    __release();
+    throw;
+  }
+  __size = n;
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const& items)
+    : small_vector() {
+  insert(end(), items.begin(), items.end());
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>::small_vector(const small_vector& v) : small_vector() {
+  insert(end(), v.begin(), v.end());
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>::small_vector(small_vector&& v) noexcept
+    : small_vector() {
+  __steal(v);
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>::~small_vector() {
+  clear();
+  __release();
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>& s21::small_vector<T, N>::operator=(
+    const small_vector& v) {
+  if (this != &v) {
+    clear();
+    insert(end(), v.begin(), v.end());
+  }
+  return *this;
+}
+
+template <class T, size_t N>
+s21::small_vector<T, N>& s21::small_vector<T, N>::operator=(
+    small_vector&& v) noexcept {
+  if (this != &v) {
+    clear();
+    __steal(v);
+  }
+  return *this;
+}
+
+/*
+  ДОСТУП К ЭЛЕМЕНТАМ
+*/
+
+template <class T, size_t N>
+T& s21::small_vector<T, N>::at(size_type i) {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return __data[i];
+}
+
+template <class T, size_t N>
+const T& s21::small_vector<T, N>::at(size_type i) const {
+  if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
+  return __data[i];
+}
+
+template <class T, size_t N>
+T& s21::small_vector<T, N>::operator[](size_type i) noexcept {
+  return __data[i];
+}
+
+template <class T, size_t N>
+const T& s21::small_vector<T, N>::operator[](size_type i) const noexcept {
+  return __data[i];
+}
+
+template <class T, size_t N>
+T& s21::small_vector<T, N>::front() noexcept {
+  return __data[0];
+}
+
+template <class T, size_t N>
+const T& s21::small_vector<T, N>::front() const noexcept {
+  return __data[0];
+}
+
+template <class T, size_t N>
+T& s21::small_vector<T, N>::back() noexcept {
+  return __data[__size - 1];
+}
+
+template <class T, size_t N>
+const T& s21::small_vector<T, N>::back() const noexcept {
+  return __data[__size - 1];
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::data() noexcept {
+  return __data;
+}
+
+template <class T, size_t N>
+const T* s21::small_vector<T, N>::data() const noexcept {
+  return __data;
+}
+
+/*
+  ИТЕРАТОРЫ
+*/
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::begin() noexcept {
+  return __data;
+}
+
+template <class T, size_t N>
+const T* s21::small_vector<T, N>::begin() const noexcept {
+  return __data;
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::end() noexcept {
+  return __data + __size;
+}
+
+template <class T, size_t N>
+const T* s21::small_vector<T, N>::end() const noexcept {
+  return __data + __size;
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <class T, size_t N>
+bool s21::small_vector<T, N>::empty() const noexcept {
+  return __size == 0;
+}
+
+template <class T, size_t N>
+size_t s21::small_vector<T, N>::size() const noexcept {
+  return __size;
+}
+
+template <class T, size_t N>
+size_t s21::small_vector<T, N>::max_size() const noexcept {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::reserve(size_type new_capacity) {
+  if (new_capacity > __capacity) __relocate(new_capacity);
+}
+
+template <class T, size_t N>
+size_t s21::small_vector<T, N>::capacity() const noexcept {
+  return __capacity;
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::shrink_to_fit() {
+  if (!is_inline() && __size < __capacity)
+    __relocate(std::max(__size, N));
+}
+
+template <class T, size_t N>
+bool s21::small_vector<T, N>::is_inline() const noexcept {
+  return __data == reinterpret_cast<const T*>(__buffer);
+}
+
+/*
+  ИЗМЕНЕНИЕ КОНТЕЙНЕРА
+*/
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::clear() noexcept {
+  s21::__destroy_range(__alloc, begin(), end());
+  __size = 0;
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::insert(iterator pos, size_type n,
+                                   const_reference value) {
+  // value может ссылаться на элемент, который сдвинется
+  value_type buf(value);
+  return __insert_gap(pos - begin(), n, [&](iterator gap) {
+    s21::__construct_range(__alloc, gap, n, [&](iterator p, size_type) {
+      new (p) value_type(buf);
+    });
+  });
+}
+
+template <class T, size_t N>
+template <class InputIt, class>
+T* s21::small_vector<T, N>::insert(iterator pos, InputIt first,
+                                   InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type idx = pos - begin();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type n = std::distance(first, last);
+    return __insert_gap(idx, n, [&](iterator gap) {
+      s21::__construct_range(__alloc, gap, n, [&](iterator p, size_type) {
+        new (p) value_type(*first);
+        ++first;
+      });
+    });
+  } else {
+    // Входной диапазон проходится один раз: элементы дописываются в
+    // конец, а потом переставляются на место
+    size_type old_size = __size;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(begin() + idx, begin() + old_size, end());
+    return begin() + idx;
+  }
+}
+
+template <class T, size_t N>
+template <class... Args>
+T* s21::small_vector<T, N>::emplace(iterator pos, Args&&... args) {
+  // Аргументы могут ссылаться на элементы, которые сейчас сдвинутся
+  value_type buf(std::forward<Args>(args)...);
+  return __insert_gap(pos - begin(), 1, [&](iterator gap) {
+    new (gap) value_type(std::move(buf));
+  });
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::erase(iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::erase(iterator first, iterator last) {
+  s21::__erase_range(__alloc, first, last, end());
+  __size -= last - first;
+  return first;
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <class T, size_t N>
+template <class... Args>
+T& s21::small_vector<T, N>::emplace_back(Args&&... args) {
+  if (__size == __capacity) {
+    // Новый элемент создается раньше, чем переезжают старые, поэтому
+    // аргументы могут ссылаться на них
+    __relocate(__capacity * 2, __size, 1, [&](iterator gap) {
+      new (gap) value_type(std::forward<Args>(args)...);
+    });
+  } else {
+    new (end()) value_type(std::forward<Args>(args)...);
+  }
+  return __data[__size++];
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::pop_back() noexcept {
+  --__size;
+  s21::__destroy_range(__alloc, end(), end() + 1);
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::swap(small_vector& other) noexcept {
+  small_vector buf(std::move(other));
+  other = std::move(*this);
+  *this = std::move(buf);
+}
+
+/*
+  ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
+*/
+
+template <class T, size_t N>
+T* s21::small_vector<T, N>::__inline_data() noexcept {
+  return reinterpret_cast<T*>(__buffer);
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::__relocate(size_type new_capacity) {
+  __relocate(new_capacity, __size, 0, [](iterator) {});
+}
+
+template <class T, size_t N>
+template <class Fill>
+void s21::small_vector<T, N>::__relocate(size_type new_capacity,
+                                         size_type pos, size_type count,
+                                         Fill fill) {
+  bool on_heap = new_capacity > N;
+  iterator new_data =
+      on_heap ? __alloc.allocate(new_capacity) : __inline_data();
+  try {
+    s21::__relocate_range(__alloc, __data, __size, new_data, pos, count, fill);
+  } catch (...) {
+    if (on_heap) __alloc.deallocate(new_data, new_capacity);
+    throw;
+  }
+  __release();
+  __data = new_data;
+  __capacity = std::max(new_capacity, N);
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::__release() noexcept {
+  if (!is_inline()) {
+    __alloc.deallocate(__data, __capacity);
+    __data = __inline_data();
+    __capacity = N;
+  }
+}
+
+template <class T, size_t N>
+void s21::small_vector<T, N>::__steal(small_vector& v) noexcept {
+  if (v.is_inline()) {
+    s21::__relocate_range(__alloc, v.__data, v.__size, __data);
+  } else {
+    __release();
+    __data = v.__data;
+    __capacity = v.__capacity;
+    v.__data = v.__inline_data();
+    v.__capacity = N;
+  }
+  __size = v.__size;
+  v.__size = 0;
+}
+
+template <class T, size_t N>
+template <class Fill>
+T* s21::small_vector<T, N>::__insert_gap(size_type pos, size_type count,
+                                         Fill fill) {
+  if (__size + count > __capacity)
+    __relocate(std::max(__size + count, __capacity * 2), pos, count, fill);
+  else
+    s21::__fill_gap(__alloc, __data, __size, pos, count, fill);
+  __size += count;
+  return __data + pos;
+}
+
+#endif  // S21_SMALL_VECTOR_H
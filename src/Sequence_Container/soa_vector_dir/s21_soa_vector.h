@@ -0,0 +1,296 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "../../Additional_Container/span_dir/s21_span.h"
+#include "../vector_dir/s21_vector.h"
+
+namespace s21 {
+// Вектор строк из полей Fields..., в котором каждое поле лежит в отдельном
+// непрерывном столбце. Цикл по одному полю читает только его столбец.
+// Столбцы - это s21::vector, поэтому рост и reserve работают так же, как у
+// него
+template <class... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "At least one field is required");
+
+ public:
+  class reference;
+  class iterator;
+  using row_type = std::tuple<Fields...>;
+  using size_type = size_t;
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, row_type>;
+
+  soa_vector() = default;
+  explicit soa_vector(size_type n);
+  soa_vector(std::initializer_list<row_type> const& rows);
+
+  reference at(size_type i);
+  reference operator[](size_type i) noexcept;
+  row_type operator[](size_type i) const;
+  // Этот метод возвращает столбец поля I
+  template <size_t I>
+  span<field_type<I>> column() noexcept;
+  template <size_t I>
+  span<const field_type<I>> column() const noexcept;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type new_capacity) noexcept;
+  void shrink_to_fit() noexcept;
+
+  void clear() noexcept;
+  void push_back(const Fields&... values) noexcept;
+  void push_back(const row_type& row) noexcept;
+  template <class... Args>
+  reference emplace_back(Args&&... args) noexcept;
+  void pop_back() noexcept;
+  void resize(size_type n) noexcept;
+  void swap(soa_vector& other) noexcept;
+
+  // Прокси на строку: ссылки на поля в разных столбцах
+  class reference {
+   public:
+    explicit reference(Fields&... fields) : __fields(fields...) {}
+    reference(const reference& other) = default;
+
+    // Присваивание меняет значения полей, а не то, на что ссылается прокси
+    reference& operator=(const reference& other) {
+      __fields = other.__fields;
+      return *this;
+    }
+    reference& operator=(const row_type& row) {
+      __fields = row;
+      return *this;
+    }
+
+    // Этот метод возвращает поле I строки
+    template <size_t I>
+    field_type<I>& get() const {
+      return std::get<I>(__fields);
+    }
+
+    // Копия строки
+    operator row_type() const { return row_type(__fields); }
+
+   private:
+    std::tuple<Fields&...> __fields;
+  };
+
+  // Итератор по строкам, разыменование возвращает прокси
+  class iterator {
+   public:
+    iterator(soa_vector* owner, size_type index)
+        : __owner(owner), __index(index) {}
+
+    reference operator*() const { return (*__owner)[__index]; }
+    iterator& operator++() {
+      ++__index;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator buf(*this);
+      ++__index;
+      return buf;
+    }
+    bool operator==(const iterator& other) const {
+      return __index == other.__index;
+    }
+    bool operator!=(const iterator& other) const {
+      return __index != other.__index;
+    }
+    // Этот метод возвращает номер строки
+    size_type index() const { return __index; }
+
+   private:
+    soa_vector* __owner;
+    size_type __index;
+  };
+
+ private:
+  std::tuple<s21::vector<Fields>...> __columns;
+
+  // Вызывает f для каждого столбца
+  template <class Func>
+  void __for_each_column(Func f) noexcept;
+  template <size_t... I>
+  reference __row(size_type i, std::index_sequence<I...>) noexcept;
+  template <size_t... I>
+  row_type __row_copy(size_type i, std::index_sequence<I...>) const;
+  template <class Tuple, size_t... I>
+  void __append(Tuple&& values, std::index_sequence<I...>) noexcept;
+  template <size_t... I>
+  void __swap(soa_vector& other, std::index_sequence<I...>) noexcept;
+};
+}  // namespace s21
+
+template <class... Fields>
+s21::soa_vector<Fields...>::soa_vector(size_type n) {
+  resize(n);
+}
+
+template <class... Fields>
+s21::soa_vector<Fields...>::soa_vector(
+    std::initializer_list<row_type> const& rows) {
+  reserve(rows.size());
+  for (const row_type& row : rows) push_back(row);
+}
+
+template <class... Fields>
+typename s21::soa_vector<Fields...>::reference s21::soa_vector<Fields...>::at(
+    size_type i) {
+  if (i >= size()) throw std::out_of_range("Index is beyond the bounds");
+  return (*this)[i];
+}
+
+template <class... Fields>
+typename s21::soa_vector<Fields...>::reference
+s21::soa_vector<Fields...>::operator[](size_type i) noexcept {
+  return __row(i, std::index_sequence_for<Fields...>{});
+}
+
+template <class... Fields>
+std::tuple<Fields...> s21::soa_vector<Fields...>::operator[](
+    size_type i) const {
+  return __row_copy(i, std::index_sequence_for<Fields...>{});
+}
+
+template <class... Fields>
+template <size_t I>
+auto s21::soa_vector<Fields...>::column() noexcept -> span<field_type<I>> {
+  return span<field_type<I>>(std::get<I>(__columns));
+}
+
+template <class... Fields>
+template <size_t I>
+auto s21::soa_vector<Fields...>::column() const noexcept
+    -> span<const field_type<I>> {
+  const auto& column = std::get<I>(__columns);
+  return span<const field_type<I>>(column.data(), column.size());
+}
+
+template <class... Fields>
+typename s21::soa_vector<Fields...>::iterator
+s21::soa_vector<Fields...>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class... Fields>
+typename s21::soa_vector<Fields...>::iterator
+s21::soa_vector<Fields...>::end() noexcept {
+  return iterator(this, size());
+}
+
+template <class... Fields>
+bool s21::soa_vector<Fields...>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class... Fields>
+size_t s21::soa_vector<Fields...>::size() const noexcept {
+  return std::get<0>(__columns).size();
+}
+
+template <class... Fields>
+size_t s21::soa_vector<Fields...>::capacity() const noexcept {
+  return std::get<0>(__columns).capacity();
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::reserve(size_type new_capacity) noexcept {
+  __for_each_column([&](auto& column) { column.reserve(new_capacity); });
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::shrink_to_fit() noexcept {
+  __for_each_column([](auto& column) { column.shrink_to_fit(); });
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::clear() noexcept {
+  __for_each_column([](auto& column) { column.clear(); });
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::push_back(const Fields&... values) noexcept {
+  __append(std::forward_as_tuple(values...),
+           std::index_sequence_for<Fields...>{});
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::push_back(const row_type& row) noexcept {
+  __append(row, std::index_sequence_for<Fields...>{});
+}
+
+template <class... Fields>
+template <class... Args>
+typename s21::soa_vector<Fields...>::reference
+s21::soa_vector<Fields...>::emplace_back(Args&&... args) noexcept {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "One argument per field is required");
+  __append(std::forward_as_tuple(std::forward<Args>(args)...),
+           std::index_sequence_for<Fields...>{});
+  return (*this)[size() - 1];
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::pop_back() noexcept {
+  __for_each_column([](auto& column) { column.pop_back(); });
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::resize(size_type n) noexcept {
+  __for_each_column([&](auto& column) { column.resize(n); });
+}
+
+template <class... Fields>
+void s21::soa_vector<Fields...>::swap(soa_vector& other) noexcept {
+  __swap(other, std::index_sequence_for<Fields...>{});
+}
+
+template <class... Fields>
+template <class Func>
+void s21::soa_vector<Fields...>::__for_each_column(Func f) noexcept {
+  std::apply([&](auto&... columns) { (f(columns), ...); }, __columns);
+}
+
+template <class... Fields>
+template <size_t... I>
+typename s21::soa_vector<Fields...>::reference
+s21::soa_vector<Fields...>::__row(size_type i,
+                                  std::index_sequence<I...>) noexcept {
+  return reference(std::get<I>(__columns)[i]...);
+}
+
+template <class... Fields>
+template <size_t... I>
+std::tuple<Fields...> s21::soa_vector<Fields...>::__row_copy(
+    size_type i, std::index_sequence<I...>) const {
+  return row_type(std::get<I>(__columns)[i]...);
+}
+
+template <class... Fields>
+template <class Tuple, size_t... I>
+void s21::soa_vector<Fields...>::__append(Tuple&& values,
+                                          std::index_sequence<I...>) noexcept {
+  (std::get<I>(__columns).emplace_back(
+       std::get<I>(std::forward<Tuple>(values))),
+   ...);
+}
+
+template <class... Fields>
+template <size_t... I>
+void s21::soa_vector<Fields...>::__swap(soa_vector& other,
+                                        std::index_sequence<I...>) noexcept {
+  (std::get<I>(__columns).swap(std::get<I>(other.__columns)), ...);
+}
+
+#endif  // S21_SOA_VECTOR_H
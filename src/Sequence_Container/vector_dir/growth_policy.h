@@ -0,0 +1,88 @@
+#ifndef S21_GROWTH_POLICY_H
+#define S21_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+
+/*
+  ПОЛИТИКИ РОСТА ВЕКТОРА
+
+  Политика решает, какой будет новая емкость, когда элементы перестают
+  помещаться в буфер:
+    next_capacity(capacity, required, element_size) - новая емкость, не
+      меньше required;
+    on_relocate(old_capacity, new_capacity, bytes) - вызывается при каждом
+      выделении буфера, в том числе в конструкторах и при копирующем
+      присваивании, bytes - размер перенесенных элементов.
+*/
+
+namespace s21 {
+// Удвоение емкости
+struct growth_double {
+  size_t next_capacity(size_t capacity, size_t required, size_t) const {
+    return std::max(required, capacity * 2);
+  }
+  void on_relocate(size_t, size_t, size_t) {}
+};
+
+// Рост в полтора раза: освободившиеся блоки могут быть использованы повторно
+struct growth_one_and_half {
+  size_t next_capacity(size_t capacity, size_t required, size_t) const {
+    return std::max(required, capacity + capacity / 2);
+  }
+  void on_relocate(size_t, size_t, size_t) {}
+};
+
+// Рост на Chunk элементов: лишней памяти не больше Chunk элементов
+template <size_t Chunk>
+struct growth_chunk {
+  static_assert(Chunk > 0, "Chunk must be positive");
+  size_t next_capacity(size_t capacity, size_t required, size_t) const {
+    return std::max(required, capacity + Chunk);
+  }
+  void on_relocate(size_t, size_t, size_t) {}
+};
+
+// Удвоение, после которого размер буфера округляется вверх до целого числа
+// страниц, чтобы хвост последней страницы не пропадал
+template <size_t PageSize = 4096>
+struct growth_page {
+  static_assert(PageSize > 0, "Page size must be positive");
+  size_t next_capacity(size_t capacity, size_t required,
+                       size_t element_size) const {
+    size_t bytes = std::max(required, capacity * 2) * element_size;
+    bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+    return std::max(required, bytes / element_size);
+  }
+  void on_relocate(size_t, size_t, size_t) {}
+};
+
+// Обертка над политикой, которая считает перевыделения памяти. Счетчики
+// принадлежат вектору и не переходят к другому при копировании и перемещении
+template <class Policy = growth_double>
+class growth_tracked : public Policy {
+ public:
+  // Этот метод возвращает количество перевыделений памяти
+  size_t reallocations() const { return reallocations_; }
+
+  // Этот метод возвращает суммарный размер перенесенных элементов в байтах
+  size_t bytes_copied() const { return bytes_copied_; }
+
+  // Этот метод возвращает наибольшую емкость за время жизни вектора
+  size_t peak_capacity() const { return peak_capacity_; }
+
+  void on_relocate(size_t old_capacity, size_t new_capacity, size_t bytes) {
+    Policy::on_relocate(old_capacity, new_capacity, bytes);
+    ++reallocations_;
+    bytes_copied_ += bytes;
+    peak_capacity_ = std::max(peak_capacity_, new_capacity);
+  }
+
+ private:
+  size_t reallocations_ = 0;
+  size_t bytes_copied_ = 0;
+  size_t peak_capacity_ = 0;
+};
+}  // namespace s21
+
+#endif  // S21_GROWTH_POLICY_H
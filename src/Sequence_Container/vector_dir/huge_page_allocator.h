@@ -0,0 +1,130 @@
+#ifndef S21_HUGE_PAGE_ALLOCATOR_H
+#define S21_HUGE_PAGE_ALLOCATOR_H
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Аллокатор для очень больших буферов. Память берется анонимным mmap, большие
+// блоки выравниваются по границе огромной страницы и помечаются
+// MADV_HUGEPAGE. Метод reallocate меняет размер блока через mremap, поэтому
+// вектор тривиально копируемых элементов растет без копирования.
+// Заголовок не входит в s21_containers.h, его подключают явно
+template <class T>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_t kHugePageSize = size_t{2} << 20;
+
+  huge_page_allocator() noexcept = default;
+  template <class U>
+  huge_page_allocator(const huge_page_allocator<U>&) noexcept {}
+
+  // Этот метод выделяет память под n элементов
+  T* allocate(size_t n) {
+    size_t bytes = RoundUp(n * sizeof(T));
+    void* address = MapAligned(bytes);
+    Advise(address, bytes);
+    return static_cast<T*>(address);
+  }
+
+  // Этот метод освобождает память, выделенную allocate или reallocate
+  void deallocate(T* p, size_t n) noexcept {
+    ::munmap(p, RoundUp(n * sizeof(T)));
+  }
+
+  // Этот метод меняет размер блока с old_n до new_n элементов и возвращает
+  // его новый адрес. Содержимое сохраняется, старый адрес становится
+  // недействительным. Новый блок выровнен так же, как после allocate
+  T* reallocate(T* p, size_t old_n, size_t new_n) {
+    size_t old_bytes = RoundUp(old_n * sizeof(T));
+    size_t new_bytes = RoundUp(new_n * sizeof(T));
+    void* address = p;
+    if (old_bytes != new_bytes) {
+#ifdef __linux__
+      // На месте блок меняется, только если его начало уже подходит для
+      // нового размера. Иначе страницы переносятся в заранее выровненное
+      // место: без MREMAP_FIXED ядро выбирает адрес само и выравнивание
+      // теряется
+      bool aligned = new_bytes < kHugePageSize ||
+                     reinterpret_cast<uintptr_t>(p) % kHugePageSize == 0;
+      address = aligned ? ::mremap(p, old_bytes, new_bytes, 0) : MAP_FAILED;
+      if (address == MAP_FAILED) address = MoveAligned(p, old_bytes, new_bytes);
+#else
+      address = MapAligned(new_bytes);
+      std::memcpy(address, p, std::min(old_bytes, new_bytes));
+      ::munmap(p, old_bytes);
+#endif
+      Advise(address, new_bytes);
+    }
+    return static_cast<T*>(address);
+  }
+
+  bool operator==(const huge_page_allocator&) const noexcept { return true; }
+  bool operator!=(const huge_page_allocator&) const noexcept { return false; }
+
+ private:
+  // Маленькие блоки округляются до обычной страницы, большие - до огромной
+  static size_t RoundUp(size_t bytes) {
+    size_t page = bytes < kHugePageSize
+                      ? static_cast<size_t>(::sysconf(_SC_PAGESIZE))
+                      : kHugePageSize;
+    return (bytes + page - 1) / page * page;
+  }
+
+  // Отображает bytes байт. Блоки из огромных страниц выравниваются по их
+  // границе: лишнее отображение по краям сразу возвращается системе
+  static void* MapAligned(size_t bytes) {
+    size_t extra = bytes < kHugePageSize ? 0 : kHugePageSize;
+    void* address = ::mmap(nullptr, bytes + extra, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED) throw std::bad_alloc();
+    if (extra) {
+      uintptr_t begin = reinterpret_cast<uintptr_t>(address);
+      uintptr_t aligned = (begin + extra - 1) / extra * extra;
+      if (aligned != begin) ::munmap(address, aligned - begin);
+      ::munmap(reinterpret_cast<void*>(aligned + bytes),
+               begin + extra - aligned);
+      address = reinterpret_cast<void*>(aligned);
+    }
+    return address;
+  }
+
+#ifdef __linux__
+  // Переносит страницы блока в новое отображение из MapAligned
+  static void* MoveAligned(void* p, size_t old_bytes, size_t new_bytes) {
+    void* target = MapAligned(new_bytes);
+    void* address = ::mremap(p, old_bytes, new_bytes,
+                             MREMAP_MAYMOVE | MREMAP_FIXED, target);
+    if (address == MAP_FAILED) {
+      ::munmap(target, new_bytes);
+      throw std::bad_alloc();
+    }
+    return address;
+  }
+#endif
+
+  // Помечает блок из огромных страниц. После mremap пометка повторяется:
+  // перенесенная или выросшая часть отображения ее может не иметь
+  static void Advise(void* address, size_t bytes) {
+#ifdef MADV_HUGEPAGE
+    if (bytes >= kHugePageSize) ::madvise(address, bytes, MADV_HUGEPAGE);
+#else
+    (void)address;
+    (void)bytes;
+#endif
+  }
+};
+}  // namespace s21
+
+#endif  // S21_HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,157 @@
+#ifndef S21_RELOCATION_H
+#define S21_RELOCATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+  ПЕРЕНОС ЭЛЕМЕНТОВ ВНУТРИ НЕПРЕРЫВНОГО БУФЕРА
+
+  Общие части s21::vector и s21::small_vector: создание и разрушение
+  диапазонов, переезд в новый буфер и сдвиг элементов при вставке и
+  удалении. Буфер и его емкость остаются у контейнера, функции только
+  создают, переносят и разрушают элементы через allocator_traits. Если
+  конструктор элемента бросает, созданное функцией разрушается, а
+  контейнер остается в прежнем состоянии.
+*/
+
+namespace s21 {
+// Вызывает деструкторы элементов [first, last). Для тривиально
+// разрушаемых типов ничего не делает
+template <class Alloc, class T>
+void __destroy_range(Alloc& alloc, T* first, T* last) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (; first != last; ++first)
+      std::allocator_traits<Alloc>::destroy(alloc, first);
+  }
+}
+
+// Создает элементы [first, first + n) вызовами make(p, i). Если make
+// бросает, уже созданные элементы разрушаются
+template <class Alloc, class T, class Make>
+void __construct_range(Alloc& alloc, T* first, size_t n, Make make) {
+  size_t i = 0;
+  try {
+    for (; i < n; ++i) make(first + i, i);
+  } catch (...) {
+    __destroy_range(alloc, first, first + i);
+    throw;
+  }
+}
+
+// Переносит size элементов from в неинициализированную память to,
+// оставляя перед позицией pos count мест. fill(to + pos) заполняет их до
+// переноса. Если fill или перенос бросают, в to ничего не остается, а from
+// не меняется. После успеха элементы from уничтожены
+template <class Alloc, class T, class Fill>
+void __relocate_range(Alloc& alloc, T* from, size_t size, T* to, size_t pos,
+                      size_t count, Fill fill) {
+  fill(to + pos);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (pos) std::memcpy(static_cast<void*>(to), from, pos * sizeof(T));
+    if (size - pos)
+      std::memcpy(static_cast<void*>(to + pos + count), from + pos,
+                  (size - pos) * sizeof(T));
+  } else {
+    size_t i = 0;
+    try {
+      for (; i < size; ++i)
+        std::allocator_traits<Alloc>::construct(
+            alloc, to + i + (i < pos ? 0 : count),
+            std::move_if_noexcept(from[i]));
+    } catch (...) {
+      // Созданы первые i элементов и count новых на месте pos
+      __destroy_range(alloc, to, to + std::min(i, pos));
+      __destroy_range(alloc, to + pos, to + count + std::max(i, pos));
+      throw;
+    }
+    __destroy_range(alloc, from, from + size);
+  }
+}
+
+// Переносит size элементов from в to без пропуска
+template <class Alloc, class T>
+void __relocate_range(Alloc& alloc, T* from, size_t size, T* to) {
+  __relocate_range(alloc, from, size, to, size, 0, [](T*) {});
+}
+
+// Сдвигает элементы [pos, size) буфера data на count вправо. Емкости
+// должно хватать. Места [pos, pos + count) после этого не инициализированы
+template <class Alloc, class T>
+void __open_gap(Alloc& alloc, T* data, size_t size, size_t pos,
+                size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (size - pos)
+      std::memmove(static_cast<void*>(data + pos + count), data + pos,
+                   (size - pos) * sizeof(T));
+  } else {
+    for (size_t i = size; i-- > pos;) {
+      if (i + count >= size)
+        std::allocator_traits<Alloc>::construct(alloc, data + i + count,
+                                                std::move(data[i]));
+      else
+        data[i + count] = std::move(data[i]);
+    }
+    __destroy_range(alloc, data + pos, data + std::min(pos + count, size));
+  }
+}
+
+// Возвращает сдвинутые __open_gap элементы на место. size - размер до
+// сдвига
+template <class Alloc, class T>
+void __close_gap(Alloc& alloc, T* data, size_t size, size_t pos,
+                 size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (size - pos)
+      std::memmove(static_cast<void*>(data + pos), data + pos + count,
+                   (size - pos) * sizeof(T));
+  } else {
+    // Места дыры не инициализированы, остальные хранят перемещенные
+    // элементы
+    for (size_t i = pos; i < size; ++i) {
+      if (i < pos + count)
+        std::allocator_traits<Alloc>::construct(alloc, data + i,
+                                                std::move(data[i + count]));
+      else
+        data[i] = std::move(data[i + count]);
+    }
+    __destroy_range(alloc, data + std::max(size, pos + count),
+                    data + size + count);
+  }
+}
+
+// Вставляет count элементов перед pos в пределах емкости: сдвигает
+// хвост, и fill(data + pos) создает элементы на пустых местах. Если fill
+// бросает, хвост возвращается на место
+template <class Alloc, class T, class Fill>
+void __fill_gap(Alloc& alloc, T* data, size_t size, size_t pos, size_t count,
+                Fill fill) {
+  if (count == 0) return;
+  __open_gap(alloc, data, size, pos, count);
+  try {
+    fill(data + pos);
+  } catch (...) {
+    __close_gap(alloc, data, size, pos, count);
+    throw;
+  }
+}
+
+// Удаляет элементы [first, last) из буфера, который заканчивается на end:
+// хвост сдвигается влево, освободившиеся места разрушаются
+template <class Alloc, class T>
+void __erase_range(Alloc& alloc, T* first, T* last, T* end) {
+  if (first == last) return;
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(static_cast<void*>(first), last, (end - last) * sizeof(T));
+  } else {
+    std::move(last, end, first);
+  }
+  __destroy_range(alloc, end - (last - first), end);
+}
+}  // namespace s21
+
+#endif  // S21_RELOCATION_H
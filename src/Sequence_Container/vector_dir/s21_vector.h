@@ -1,18 +1,48 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 #include <algorithm>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "relocation.h"
 
 namespace s21 {
 class container;
 template <class T>
 class sequence_container;
-template <class T>
+template <class T, class Allocator = std::allocator<T>,
+          class Growth = growth_double>
 class vector;
 template <class T>
 class iterator;
 template <class T>
 class reversed_iterator;
+
+// Проверяет, умеет ли аллокатор менять размер блока на месте, как
+// huge_page_allocator. Сам аллокатор подключается отдельно, потому что
+// требует POSIX mmap
+template <class Alloc, class = void>
+struct has_reallocate : std::false_type {};
+
+template <class Alloc>
+struct has_reallocate<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+               std::declval<typename Alloc::value_type*>(), size_t{},
+               size_t{}))>> : std::true_type {};
+
+namespace pmr {
+// Вектор, память для которого выдает std::pmr::memory_resource
+template <class T, class Growth = growth_double>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>, Growth>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "vector.h"
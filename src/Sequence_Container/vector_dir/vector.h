@@ -5,7 +5,7 @@
 
 #include "s21_vector.h"
 
-template <class T>
+template <class T, class Allocator, class Growth>
 class s21::vector {
  public:
   using value_type = T;
@@ -14,20 +14,30 @@ class s21::vector {
   using iterator = T*;
   using const_iterator = const T*;
   using size_type = size_t;
+  using allocator_type = Allocator;
+  using growth_policy_type = Growth;
 
   explicit vector() noexcept;
-  vector(size_type n) noexcept;
-  vector(std::initializer_list<value_type> const& items) noexcept;
-  explicit vector(const vector<value_type>& v) noexcept;
-  explicit vector(vector<value_type>&& v) noexcept;
+  explicit vector(const allocator_type& alloc) noexcept;
+  // Методы, которые выделяют память или создают элементы, пробрасывают
+  // исключения аллокатора и конструкторов. После исключения вектор остается
+  // корректным, а память и созданные элементы не теряются
+  vector(size_type n, const allocator_type& alloc = allocator_type());
+  vector(std::initializer_list<value_type> const& items,
+         const allocator_type& alloc = allocator_type());
+  explicit vector(const vector& v);
+  vector(const vector& v, const allocator_type& alloc);
+  explicit vector(vector&& v) noexcept;
   ~vector() noexcept;
-  vector<value_type>& operator=(vector<value_type>& v) noexcept;
-  vector<value_type>& operator=(vector<value_type>&& v) noexcept;
+  vector& operator=(const vector& v);
+  // С неравными аллокаторами элементы переносятся в новую память
+  vector& operator=(vector&& v) noexcept(__steals_on_move);
 
   reference at(size_type i);
   const_reference front() const noexcept;
   const_reference back() const noexcept;
   T* data() noexcept;
+  const T* data() const noexcept;
 
   iterator begin() noexcept;
   iterator end() noexcept;
@@ -35,42 +45,118 @@ class s21::vector {
   bool empty() const noexcept;
   size_type size() const noexcept;
   size_type max_size() const noexcept;
-  void reserve(size_type new_capacity) noexcept;
+  void reserve(size_type new_capacity);
   size_type capacity() const noexcept;
-  void shrink_to_fit() noexcept;
+  void shrink_to_fit();
+  void resize(size_type n);
+  void resize(size_type n, const_reference value);
+  // Как resize(n), но тривиально конструируемые элементы остаются
+  // неинициализированными: память не заполняется нулями
+  void resize_default_init(size_type n);
 
   void clear() noexcept;
-  iterator insert(iterator pos, const_reference value) noexcept;
-  void erase(iterator pos) noexcept;
-  void push_back(const_reference value) noexcept;
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, size_type n, const_reference value);
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <class... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  void erase(iterator pos);
+  void erase(iterator first, iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
   void pop_back() noexcept;
   void swap(vector& other) noexcept;
+  allocator_type get_allocator() const noexcept;
+  // Политика роста. У growth_tracked через нее читаются счетчики
+  const growth_policy_type& growth_policy() const noexcept;
 
   reference operator[](size_type i) noexcept;
   const_reference operator[](size_type i) const noexcept;
 
-  static int __vector_cmp(const vector<value_type>& lhs,
-                          const vector<value_type>& rhs);
+  static int __vector_cmp(const vector& lhs, const vector& rhs);
 
  private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                "Allocator must use raw pointers");
+
+  // Тривиально копируемые элементы переезжают вместе с блоком памяти, если
+  // аллокатор умеет менять его размер (см. huge_page_allocator)
+  static constexpr bool __grows_in_place =
+      std::is_trivially_copyable_v<T> && has_reallocate<Allocator>::value;
+  // Перемещающее присваивание всегда забирает чужой буфер и не выделяет
+  // память
+  static constexpr bool __steals_on_move =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+  allocator_type __alloc;
+  growth_policy_type __growth;
   size_type __size, __capacity;
   iterator __data;
 
-  void __copy_data(const_iterator data) noexcept;
+  // Выделяет неинициализированную память под n элементов
+  iterator __allocate(size_type n);
+  // Освобождает память, выделенную __allocate
+  void __deallocate(iterator data, size_type n) noexcept;
+  // Создает элемент в неинициализированной памяти через аллокатор
+  template <class... Args>
+  void __construct(iterator p, Args&&... args);
+  // Вызывает деструкторы элементов [first, last). Для тривиально
+  // разрушаемых типов ничего не делает
+  void __destroy(iterator first, iterator last) noexcept;
+  // Создает элементы [first, first + n) вызовами make(p, i). Если make
+  // бросает, уже созданные элементы разрушаются
+  template <class Make>
+  void __construct_n(iterator first, size_type n, Make make);
+  // Создает в пустом буфере копии n элементов data и только потом делает
+  // их размером вектора
+  void __copy_data(const_iterator data, size_type n);
+  // Заполняет буфер только что созданного вектора. Если заполнение
+  // бросает, буфер освобождается: деструктор недостроенного объекта не
+  // вызывается
+  template <class Make>
+  void __init(size_type n, Make make);
+  // Возвращает емкость, которую выбирает политика роста, когда нужно
+  // разместить required элементов
+  size_type __next_capacity(size_type required);
+  // Переносит элементы в новый буфер емкостью new_capacity
+  void __relocate(size_type new_capacity);
+  // То же, но оставляет перед позицией pos count свободных мест. fill
+  // заполняет их до того, как старые элементы будут уничтожены
+  template <class Fill>
+  void __relocate(size_type new_capacity, size_type pos, size_type count,
+                  Fill fill);
+  // Меняет размер на n. Новые места [end, begin + n) заполняет fill
+  template <class Fill>
+  void __resize(size_type n, Fill fill);
+  // Вставляет count элементов перед pos, fill создает их на пустых местах
+  template <class Fill>
+  iterator __insert_gap(size_type pos, size_type count, Fill fill);
 };
 
-template <class T>
-bool operator==(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
-template <class T>
-bool operator!=(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
-template <class T>
-bool operator<(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
-template <class T>
-bool operator<=(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
-template <class T>
-bool operator>(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
-template <class T>
-bool operator>=(const s21::vector<T>& lhs, const s21::vector<T>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator==(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator!=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator<(const s21::vector<T, Allocator, Growth>& lhs,
+               const s21::vector<T, Allocator, Growth>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator<=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator>(const s21::vector<T, Allocator, Growth>& lhs,
+               const s21::vector<T, Allocator, Growth>& rhs);
+template <class T, class Allocator, class Growth>
+bool operator>=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs);
 
 #include "vector/constructors_and_destructor.cpp"
 #include "vector/functions.cpp"
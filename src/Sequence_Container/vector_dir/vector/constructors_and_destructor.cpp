@@ -1,35 +1,55 @@
 #include "../vector.h"
 
-template <class T>
-s21::vector<T>::vector() noexcept : s21::vector<T>::vector(0) {}
-
-template <class T>
-s21::vector<T>::vector(size_type n) noexcept : __size{n}, __capacity{n} {
-  if (n != 0)
-    __data = new (std::nothrow) value_type[__capacity];
-  else
-    __data = nullptr;
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector() noexcept
+    : s21::vector<T, Allocator, Growth>::vector(0) {}
+
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(const allocator_type& alloc) noexcept
+    : s21::vector<T, Allocator, Growth>::vector(0, alloc) {}
+
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(size_type n,
+                                          const allocator_type& alloc)
+    : __alloc{alloc}, __size{0}, __capacity{0}, __data{nullptr} {
+  __init(n, [&](iterator p, size_type) { __construct(p); });
 }
 
-template <class T>
-s21::vector<T>::vector(std::initializer_list<value_type> const& items) noexcept
-    : s21::vector<T>::vector(items.size()) {
-  __copy_data(std::data(items));
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(
+    std::initializer_list<value_type> const& items,
+    const allocator_type& alloc)
+    : __alloc{alloc}, __size{0}, __capacity{0}, __data{nullptr} {
+  const_iterator data = std::data(items);
+  __init(items.size(),
+         [&](iterator p, size_type i) { __construct(p, data[i]); });
 }
 
-template <class T>
-s21::vector<T>::vector(const vector<value_type>& v) noexcept
-    : s21::vector<T>::vector(v.__size) {
-  __copy_data(v.__data);
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(const vector& v)
+    : s21::vector<T, Allocator, Growth>::vector(
+          v, alloc_traits::select_on_container_copy_construction(v.__alloc)) {}
+
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(const vector& v,
+                                          const allocator_type& alloc)
+    : __alloc{alloc}, __size{0}, __capacity{0}, __data{nullptr} {
+  __init(v.__size,
+         [&](iterator p, size_type i) { __construct(p, v.__data[i]); });
 }
 
-template <class T>
-s21::vector<T>::vector(vector<value_type>&& v) noexcept
-    : s21::vector<T>::vector() {
-  *this = std::move(v);
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::vector(vector&& v) noexcept
+    : __alloc{std::move(v.__alloc)},
+      __size{v.__size},
+      __capacity{v.__capacity},
+      __data{v.__data} {
+  v.__size = v.__capacity = 0;
+  v.__data = nullptr;
 }
 
-template <class T>
-s21::vector<T>::~vector() noexcept {
-  delete[] __data;
-}
\ No newline at end of file
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>::~vector() noexcept {
+  __destroy(begin(), end());
+  __deallocate(__data, __capacity);
+}
@@ -1,10 +1,56 @@
 #include "../vector.h"
 
-template <class T>
-int __vector_cmp(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  int result = 0;
-  if (lhs.__size != rhs.__size) result = lhs.__size - rhs.__size;
-  for (size_t i = 0; i < lhs.__size && !result; ++i)
-    result = lhs.__data[i] - rhs.__data[i];
-  return result;
-}
\ No newline at end of file
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_VECTOR_X86_KERNELS
+#endif
+
+namespace s21 {
+
+#ifdef S21_VECTOR_X86_KERNELS
+// Ядра сравнивают блоки по 16 или 32 байта и возвращают индекс первого
+// различающегося байта или начало необработанного хвоста
+__attribute__((target("sse2"))) inline size_t __vector_mismatch_sse2(
+    const unsigned char* lhs, const unsigned char* rhs, size_t n) noexcept {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+    unsigned mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) & 0xFFFFu;
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) inline size_t __vector_mismatch_avx2(
+    const unsigned char* lhs, const unsigned char* rhs, size_t n) noexcept {
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+    unsigned mask =
+        ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+#endif
+
+// Возвращает индекс первого различающегося байта двух буферов или n.
+// Ядро выбирается по возможностям процессора при первом вызове
+inline size_t __vector_mismatch(const void* lhs, const void* rhs,
+                                size_t n) noexcept {
+  const unsigned char* left = static_cast<const unsigned char*>(lhs);
+  const unsigned char* right = static_cast<const unsigned char*>(rhs);
+  size_t i = 0;
+#ifdef S21_VECTOR_X86_KERNELS
+  static const bool has_avx2 =
+      (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+  i = has_avx2 ? __vector_mismatch_avx2(left, right, n)
+               : __vector_mismatch_sse2(left, right, n);
+#endif
+  while (i < n && left[i] == right[i]) ++i;
+  return i;
+}
+
+}  // namespace s21
@@ -1,131 +1,390 @@
 #include "../vector.h"
 
-template <class T>
-void s21::vector<T>::__copy_data(const_iterator data) noexcept {
-  for (size_type i = 0; i < __size; ++i) __data[i] = data[i];
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::__allocate(size_type n) {
+  return n ? alloc_traits::allocate(__alloc, n) : nullptr;
 }
 
-template <class T>
-T& s21::vector<T>::at(size_type i) {
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::__deallocate(iterator data,
+                                                     size_type n) noexcept {
+  if (data) alloc_traits::deallocate(__alloc, data, n);
+}
+
+template <class T, class Allocator, class Growth>
+template <class... Args>
+void s21::vector<T, Allocator, Growth>::__construct(iterator p,
+                                                    Args&&... args) {
+  alloc_traits::construct(__alloc, p, std::forward<Args>(args)...);
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::__destroy(iterator first,
+                                                  iterator last) noexcept {
+  s21::__destroy_range(__alloc, first, last);
+}
+
+template <class T, class Allocator, class Growth>
+template <class Make>
+void s21::vector<T, Allocator, Growth>::__construct_n(iterator first,
+                                                      size_type n,
+                                                      Make make) {
+  s21::__construct_range(__alloc, first, n, make);
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::__copy_data(const_iterator data,
+                                                    size_type n) {
+  __construct_n(__data, n,
+                [&](iterator p, size_type i) { __construct(p, data[i]); });
+  __size = n;
+}
+
+template <class T, class Allocator, class Growth>
+template <class Make>
+void s21::vector<T, Allocator, Growth>::__init(size_type n, Make make) {
+  if (n) __relocate(n);
+  try {
+    __construct_n(__data, n, make);
+  } catch (...) {
+    __deallocate(__data, __capacity);
+    throw;
+  }
+  __size = n;
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::__relocate(size_type new_capacity) {
+  __relocate(new_capacity, __size, 0, [](iterator) {});
+}
+
+template <class T, class Allocator, class Growth>
+template <class Fill>
+void s21::vector<T, Allocator, Growth>::__relocate(size_type new_capacity,
+                                                   size_type pos,
+                                                   size_type count,
+                                                   Fill fill) {
+  if constexpr (__grows_in_place) {
+    // Аллокатор сам переносит блок, элементы не копируются
+    if (count == 0 && __data != nullptr && new_capacity != 0) {
+      __data = __alloc.reallocate(__data, __capacity, new_capacity);
+      __growth.on_relocate(__capacity, new_capacity, 0);
+      __capacity = new_capacity;
+      return;
+    }
+  }
+  // До конца переезда старый буфер не меняется: если выделение, fill или
+  // копирование элемента бросит, новый буфер освобождается, а вектор
+  // остается прежним
+  iterator new_data = __allocate(new_capacity);
+  try {
+    s21::__relocate_range(__alloc, __data, __size, new_data, pos, count, fill);
+  } catch (...) {
+    __deallocate(new_data, new_capacity);
+    throw;
+  }
+  __growth.on_relocate(__capacity, new_capacity, __size * sizeof(value_type));
+  __deallocate(__data, __capacity);
+  __data = new_data;
+  __capacity = new_capacity;
+}
+
+template <class T, class Allocator, class Growth>
+template <class Fill>
+void s21::vector<T, Allocator, Growth>::__resize(size_type n, Fill fill) {
+  if (n < __size) {
+    __destroy(begin() + n, end());
+  } else if (n > __size) {
+    if (n > __capacity) __relocate(__next_capacity(n));
+    fill(end(), __data + n);
+  }
+  __size = n;
+}
+
+template <class T, class Allocator, class Growth>
+template <class Fill>
+T* s21::vector<T, Allocator, Growth>::__insert_gap(size_type pos,
+                                                   size_type count,
+                                                   Fill fill) {
+  if (__size + count > __capacity && !__grows_in_place) {
+    __relocate(__next_capacity(__size + count), pos, count, fill);
+  } else {
+    if (__size + count > __capacity)
+      __relocate(__next_capacity(__size + count));
+    s21::__fill_gap(__alloc, __data, __size, pos, count, fill);
+  }
+  __size += count;
+  return __data + pos;
+}
+
+template <class T, class Allocator, class Growth>
+size_t s21::vector<T, Allocator, Growth>::__next_capacity(size_type required) {
+  return std::max(required, __growth.next_capacity(__capacity, required,
+                                                   sizeof(value_type)));
+}
+
+template <class T, class Allocator, class Growth>
+T& s21::vector<T, Allocator, Growth>::at(size_type i) {
   if (i >= __size) throw std::out_of_range("Index is beyond the bounds");
   return __data[i];
 }
 
-template <class T>
-const T& s21::vector<T>::front() const noexcept {
+template <class T, class Allocator, class Growth>
+const T& s21::vector<T, Allocator, Growth>::front() const noexcept {
   return __data[0];
 }
 
-template <class T>
-const T& s21::vector<T>::back() const noexcept {
+template <class T, class Allocator, class Growth>
+const T& s21::vector<T, Allocator, Growth>::back() const noexcept {
   return __data[__size - 1];
 }
 
-template <class T>
-T* s21::vector<T>::data() noexcept {
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::data() noexcept {
   return __data;
 }
 
-template <class T>
-T* s21::vector<T>::begin() noexcept {
+template <class T, class Allocator, class Growth>
+const T* s21::vector<T, Allocator, Growth>::data() const noexcept {
   return __data;
 }
 
-template <class T>
-T* s21::vector<T>::end() noexcept {
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::begin() noexcept {
+  return __data;
+}
+
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::end() noexcept {
   return __data + __size;
 }
 
-template <class T>
-bool s21::vector<T>::empty() const noexcept {
+template <class T, class Allocator, class Growth>
+bool s21::vector<T, Allocator, Growth>::empty() const noexcept {
   return __size == 0;
 }
 
-template <class T>
-size_t s21::vector<T>::size() const noexcept {
+template <class T, class Allocator, class Growth>
+size_t s21::vector<T, Allocator, Growth>::size() const noexcept {
   return __size;
 }
 
-template <class T>
-size_t s21::vector<T>::max_size() const noexcept {
+template <class T, class Allocator, class Growth>
+size_t s21::vector<T, Allocator, Growth>::max_size() const noexcept {
   // return static_cast<size_t>(pow(2, 64 - sizeof(T) / 2)) - 1;
-  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+  return std::min<size_type>(alloc_traits::max_size(__alloc),
+                             std::numeric_limits<std::size_t>::max() /
+                                 sizeof(value_type));
 }
 
-template <class T>
-void s21::vector<T>::reserve(size_type new_capacity) noexcept {
-  if (new_capacity > __capacity) {
-    vector<T> new_vector(new_capacity);
-    new_vector.__size = __size;
-    new_vector.__copy_data(__data);
-    *this = std::move(new_vector);
-  }
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::reserve(size_type new_capacity) {
+  if (new_capacity > __capacity) __relocate(new_capacity);
 }
 
-template <class T>
-size_t s21::vector<T>::capacity() const noexcept {
+template <class T, class Allocator, class Growth>
+size_t s21::vector<T, Allocator, Growth>::capacity() const noexcept {
   return __capacity;
 }
 
-template <class T>
-void s21::vector<T>::shrink_to_fit() noexcept {
-  if (__size < __capacity) {
-    vector<T> new_vector(__size);
-    new_vector.__copy_data(__data);
-    *this = std::move(new_vector);
-  }
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::shrink_to_fit() {
+  if (__size < __capacity) __relocate(__size);
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::resize(size_type n) {
+  __resize(n, [&](iterator first, iterator last) {
+    __construct_n(first, last - first,
+                  [&](iterator p, size_type) { __construct(p); });
+  });
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::resize(size_type n,
+                                               const_reference value) {
+  // value может ссылаться на элемент, а буфер может переехать
+  value_type buf(value);
+  __resize(n, [&](iterator first, iterator last) {
+    __construct_n(first, last - first,
+                  [&](iterator p, size_type) { __construct(p, buf); });
+  });
 }
 
-template <class T>
-void s21::vector<T>::clear() noexcept {
-  for (size_type i = 0; i < __size; ++i) __data[i] = value_type();
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::resize_default_init(size_type n) {
+  __resize(n, [&]([[maybe_unused]] iterator first,
+                  [[maybe_unused]] iterator last) {
+    if constexpr (!std::is_trivially_default_constructible_v<value_type>) {
+      __construct_n(first, last - first,
+                    [&](iterator p, size_type) { __construct(p); });
+    }
+  });
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::clear() noexcept {
+  __destroy(begin(), end());
   __size = 0;
 }
 
-template <class T>
-T* s21::vector<T>::insert(iterator pos, const_reference value) noexcept {
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::insert(iterator pos,
+                                             const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class T, class Allocator, class Growth>
+T* s21::vector<T, Allocator, Growth>::insert(iterator pos, size_type n,
+                                             const_reference value) {
+  // value может ссылаться на элемент, который сдвинется
+  value_type buf(value);
+  return __insert_gap(pos - begin(), n, [&](iterator gap) {
+    __construct_n(gap, n, [&](iterator p, size_type) { __construct(p, buf); });
+  });
+}
+
+template <class T, class Allocator, class Growth>
+template <class InputIt, class>
+T* s21::vector<T, Allocator, Growth>::insert(iterator pos, InputIt first,
+                                             InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
   size_type idx = pos - begin();
-  if (__size == __capacity) reserve(__capacity ? __capacity * 2 : 1);
-  iterator new_pos = begin() + idx;
-  for (iterator it = end(); it != new_pos; --it) {
-    *it = *(it - 1);
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type n = std::distance(first, last);
+    return __insert_gap(idx, n, [&](iterator gap) {
+      __construct_n(gap, n, [&](iterator p, size_type) {
+        __construct(p, *first);
+        ++first;
+      });
+    });
+  } else {
+    // Диапазон можно пройти только один раз: элементы дописываются в
+    // конец, а потом переставляются на место
+    size_type old_size = __size;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(begin() + idx, begin() + old_size, end());
+    return begin() + idx;
   }
+}
 
-  *new_pos = value;
+template <class T, class Allocator, class Growth>
+template <class... Args>
+T* s21::vector<T, Allocator, Growth>::emplace(iterator pos, Args&&... args) {
+  size_type idx = pos - begin();
+  if (__size == __capacity) {
+    if constexpr (__grows_in_place) {
+      // Блок памяти переедет, а аргументы могут ссылаться на элементы
+      value_type buf(std::forward<Args>(args)...);
+      __relocate(__next_capacity(__size + 1));
+      return emplace(begin() + idx, std::move(buf));
+    } else {
+      __relocate(__next_capacity(__size + 1), idx, 1, [&](iterator gap) {
+        __construct(gap, std::forward<Args>(args)...);
+      });
+    }
+  } else if (idx == __size) {
+    __construct(end(), std::forward<Args>(args)...);
+  } else {
+    // Аргументы могут ссылаться на элементы, которые сейчас сдвинутся
+    value_type buf(std::forward<Args>(args)...);
+    return __insert_gap(idx, 1, [&](iterator gap) {
+      __construct(gap, std::move(buf));
+    });
+  }
   ++__size;
-  return new_pos;
+  return begin() + idx;
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::erase(iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::erase(iterator first,
+                                              iterator last) {
+  s21::__erase_range(__alloc, first, last, end());
+  __size -= last - first;
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-template <class T>
-void s21::vector<T>::erase(iterator pos) noexcept {
-  *pos = value_type();
-  for (iterator it = pos; it < this->end(); ++it) *it = *(it + 1);
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
 
+template <class T, class Allocator, class Growth>
+template <class... Args>
+T& s21::vector<T, Allocator, Growth>::emplace_back(Args&&... args) {
+  if (__size == __capacity) {
+    if constexpr (__grows_in_place) {
+      // Блок памяти переедет, а аргументы могут ссылаться на элементы
+      value_type buf(std::forward<Args>(args)...);
+      __relocate(__next_capacity(__size + 1));
+      return emplace_back(std::move(buf));
+    } else {
+      __relocate(__next_capacity(__size + 1), __size, 1, [&](iterator gap) {
+        __construct(gap, std::forward<Args>(args)...);
+      });
+    }
+  } else {
+    __construct(end(), std::forward<Args>(args)...);
+  }
+  return __data[__size++];
+}
+
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::pop_back() noexcept {
   --__size;
+  __destroy(end(), end() + 1);
 }
 
-template <class T>
-void s21::vector<T>::push_back(const_reference value) noexcept {
-  if (__size == __capacity) reserve(__capacity ? __capacity * 2 : 1);
-  __data[__size++] = value;
+template <class T, class Allocator, class Growth>
+void s21::vector<T, Allocator, Growth>::swap(vector& other) noexcept {
+  std::swap(__data, other.__data);
+  std::swap(__size, other.__size);
+  std::swap(__capacity, other.__capacity);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(__alloc, other.__alloc);
 }
 
-template <class T>
-void s21::vector<T>::pop_back() noexcept {
-  __data[--__size] = value_type();
+template <class T, class Allocator, class Growth>
+Allocator s21::vector<T, Allocator, Growth>::get_allocator() const noexcept {
+  return __alloc;
 }
 
-template <class T>
-void s21::vector<T>::swap(vector& other) noexcept {
-  *this = std::move(other);
+template <class T, class Allocator, class Growth>
+const Growth& s21::vector<T, Allocator, Growth>::growth_policy()
+    const noexcept {
+  return __growth;
 }
 
-template <class T>
-int s21::vector<T>::__vector_cmp(const s21::vector<T>& lhs,
-                                 const s21::vector<T>& rhs) {
+template <class T, class Allocator, class Growth>
+int s21::vector<T, Allocator, Growth>::__vector_cmp(const vector& lhs,
+                                                    const vector& rhs) {
+  size_type common = std::min(lhs.__size, rhs.__size);
+  size_type i = 0;
+  // Для целых чисел, перечислений и указателей равенство значений - это
+  // равенство байтов, поэтому первое различие ищется векторным сравнением
+  // памяти. Порядок различающихся элементов все равно задает их operator<.
+  // У остальных типов операторы могут смотреть не на все байты
+  if constexpr (std::is_integral_v<value_type> || std::is_enum_v<value_type> ||
+                std::is_pointer_v<value_type>) {
+    i = __vector_mismatch(lhs.__data, rhs.__data,
+                          common * sizeof(value_type)) /
+        sizeof(value_type);
+  } else {
+    while (i < common && lhs.__data[i] == rhs.__data[i]) ++i;
+  }
   int result = 0;
-  if (lhs.__size != rhs.__size) result = lhs.__size - rhs.__size;
-  for (size_t i = 0; i < lhs.__size && !result; ++i)
-    result = lhs.__data[i] - rhs.__data[i];
+  if (i < common)
+    result = lhs.__data[i] < rhs.__data[i] ? -1 : 1;
+  else if (lhs.__size != rhs.__size)
+    result = lhs.__size < rhs.__size ? -1 : 1;
   return result;
-}
\ No newline at end of file
+}
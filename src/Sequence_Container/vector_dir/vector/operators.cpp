@@ -1,62 +1,110 @@
 #include "../vector.h"
 
-template <class T>
-s21::vector<T>& s21::vector<T>::operator=(vector<value_type>& v) noexcept {
-  if (__data != v.__data) {
-    delete[] __data;
-    __size = v.__size;
-    __capacity = v.__capacity;
-    __data = new (std::nothrow) value_type[__capacity];
-    this->__copy_data(v.__data);
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>& s21::vector<T, Allocator, Growth>::operator=(
+    const vector& v) {
+  if (this != &v) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      // Память нужно вернуть тому аллокатору, которым она выделена
+      if (!alloc_traits::is_always_equal::value && __alloc != v.__alloc) {
+        clear();
+        __deallocate(__data, __capacity);
+        __data = nullptr;
+        __capacity = 0;
+      }
+      __alloc = v.__alloc;
+    }
+    if (v.__size > __capacity) {
+      // Выделяется ровно v.size(): это не рост, и политика роста здесь не
+      // участвует, но переезд все равно проходит через __relocate и
+      // попадает в счетчики. Старые элементы уничтожаются до переезда и не
+      // копируются
+      clear();
+      __relocate(v.__size);
+      __copy_data(v.__data, v.__size);
+    } else {
+      // Живым элементам значения присваиваются, недостающие создаются в
+      // свободной части буфера, лишние уничтожаются
+      size_type common = std::min(__size, v.__size);
+      std::copy(v.__data, v.__data + common, __data);
+      __construct_n(__data + common, v.__size - common,
+                    [&](iterator p, size_type i) {
+                      __construct(p, v.__data[common + i]);
+                    });
+      if (v.__size < __size) __destroy(__data + v.__size, __data + __size);
+      __size = v.__size;
+    }
   }
   return *this;
 }
 
-template <class T>
-s21::vector<T>& s21::vector<T>::operator=(vector<value_type>&& v) noexcept {
+template <class T, class Allocator, class Growth>
+s21::vector<T, Allocator, Growth>& s21::vector<T, Allocator, Growth>::operator=(
+    vector&& v) noexcept(__steals_on_move) {
   if (__data != v.__data) {
-    std::swap(__data, v.__data);
-    std::swap(__size, v.__size);
-    std::swap(__capacity, v.__capacity);
+    if (__steals_on_move || __alloc == v.__alloc) {
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+        std::swap(__alloc, v.__alloc);
+      std::swap(__data, v.__data);
+      std::swap(__size, v.__size);
+      std::swap(__capacity, v.__capacity);
+    } else {
+      // Чужую память нельзя освободить своим аллокатором, поэтому элементы
+      // переносятся по одному
+      clear();
+      reserve(v.__size);
+      __construct_n(__data, v.__size, [&](iterator p, size_type i) {
+        __construct(p, std::move(v.__data[i]));
+      });
+      __size = v.__size;
+      v.clear();
+    }
   }
   return *this;
 }
 
-template <class T>
-T& s21::vector<T>::operator[](size_type i) noexcept {
+template <class T, class Allocator, class Growth>
+T& s21::vector<T, Allocator, Growth>::operator[](size_type i) noexcept {
   return __data[i];
 }
 
-template <class T>
-const T& s21::vector<T>::operator[](size_type i) const noexcept {
+template <class T, class Allocator, class Growth>
+const T& s21::vector<T, Allocator, Growth>::operator[](
+    size_type i) const noexcept {
   return __data[i];
 }
 
-template <class T>
-bool operator==(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) == 0;
+template <class T, class Allocator, class Growth>
+bool operator==(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) == 0;
 }
 
-template <class T>
-bool operator!=(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) != 0;
+template <class T, class Allocator, class Growth>
+bool operator!=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) != 0;
 }
 
-template <class T>
-bool operator<(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) < 0;
+template <class T, class Allocator, class Growth>
+bool operator<(const s21::vector<T, Allocator, Growth>& lhs,
+               const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) < 0;
 }
 
-template <class T>
-bool operator<=(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) <= 0;
+template <class T, class Allocator, class Growth>
+bool operator<=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) <= 0;
 }
-template <class T>
-bool operator>(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) > 0;
+template <class T, class Allocator, class Growth>
+bool operator>(const s21::vector<T, Allocator, Growth>& lhs,
+               const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) > 0;
 }
 
-template <class T>
-bool operator>=(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
-  return s21::vector<T>::__vector_cmp(lhs, rhs) >= 0;
+template <class T, class Allocator, class Growth>
+bool operator>=(const s21::vector<T, Allocator, Growth>& lhs,
+                const s21::vector<T, Allocator, Growth>& rhs) {
+  return s21::vector<T, Allocator, Growth>::__vector_cmp(lhs, rhs) >= 0;
 }
\ No newline at end of file
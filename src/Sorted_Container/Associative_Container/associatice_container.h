@@ -1,4 +1,5 @@
 #ifndef S21_CONTAINERS_SRC_ASSOCIATED_SRC_SORTED_CONTAINERS_H_
 #define S21_CONTAINERS_SRC_ASSOCIATED_SRC_SORTED_CONTAINERS_H_
+#include "interval_map_dir/s21_interval_map.h"
 #include "map_dir/s21_map.h"
 #endif
\ No newline at end of file
@@ -0,0 +1,294 @@
+#ifndef S21_INTERVAL_MAP_H
+#define S21_INTERVAL_MAP_H
+
+#include <stdexcept>
+#include <vector>
+
+#include "../../RBtree/s21_RBtree.h"
+
+namespace s21 {
+// Данные, которые хранятся в узле интервального дерева. Ключ узла является
+// левой границей полуинтервала [key, end)
+template <typename Key, typename Value>
+struct interval_entry {
+  Key end;
+  Key max_end;
+  Value value;
+};
+}  // namespace s21
+
+// Пересчитывает максимальную правую границу поддерева. Дерево вызывает
+// update после поворотов и для предков вставленного или удаленного узла
+template <typename Key, typename Value>
+struct RBtreeAugment<Key, s21::interval_entry<Key, Value>> {
+  static constexpr bool enabled = true;
+  static void update(Node<Key, s21::interval_entry<Key, Value>>* node) {
+    node->value.max_end = node->value.end;
+    if (node->left != nullptr &&
+        node->value.max_end < node->left->value.max_end)
+      node->value.max_end = node->left->value.max_end;
+    if (node->right != nullptr &&
+        node->value.max_end < node->right->value.max_end)
+      node->value.max_end = node->right->value.max_end;
+  }
+};
+
+namespace s21 {
+template <typename Key, typename Value>
+class interval_map : public RBtree<Key, interval_entry<Key, Value>> {
+ public:
+  class IntervalIterator;
+  using key_type = Key;
+  using mapped_type = Value;
+  using entry_type = interval_entry<Key, Value>;
+  using iterator = IntervalIterator;
+  using size_type = size_t;
+
+  /*
+  Публичные методы для взаимодействия с классом
+  */
+
+  // Конструктор по умолчанию
+  interval_map();
+
+  // Конструктор копирования
+  interval_map(const interval_map& other);
+
+  // Конструктор перемещения
+  interval_map(interval_map&& other) noexcept;
+
+  // Оператор копирующего присваивания
+  interval_map& operator=(const interval_map& other);
+
+  // Оператор перемещающего присваивания
+  interval_map& operator=(interval_map&& other);
+
+  // Деструктор
+  ~interval_map();
+
+  /*
+  ИТЕРАТОРЫ
+  */
+
+  // Этот метод возвращает итератор на интервал с наименьшим началом
+  iterator begin();
+
+  // Этот метод возвращает итератор на интервал с наибольшим началом
+  iterator end();
+
+  /*
+  РАЗМЕРЫ
+  */
+
+  // Этот метод проверяет на пустоту контейнер
+  bool empty();
+
+  // Этот метод возвращает количество интервалов в контейнере
+  size_type size();
+
+  /*
+  Публичные методы для изменения контейнера:
+  */
+
+  // Этот метод очищает содержимое контейнера
+  void clear();
+
+  // Этот метод вставляет полуинтервал [start, end) со значением.
+  // Интервалы с одинаковым началом допускаются
+  iterator insert(const Key& start, const Key& end, const Value& value);
+
+  // Этот метод стирает интервал с позиции
+  void erase(iterator pos);
+
+  // Этот метод меняет местами содержимое
+  void swap(interval_map& other);
+
+  /*
+  ПОИСК
+  */
+
+  // Этот метод возвращает все интервалы, которые содержат точку
+  std::vector<iterator> overlapping(const Key& point);
+
+  // Этот метод возвращает все интервалы, которые пересекаются с [lo, hi)
+  std::vector<iterator> overlapping(const Key& lo, const Key& hi);
+
+  class IntervalIterator
+      : public RBtree<Key, interval_entry<Key, Value>>::Iterator {
+   public:
+    friend class interval_map;
+    IntervalIterator() : RBtree<Key, entry_type>::Iterator(){};
+    IntervalIterator(Node<Key, entry_type>* iter_ptr)
+        : RBtree<Key, entry_type>::Iterator(iter_ptr){};
+
+    // Этот метод возвращает правую границу интервала
+    Key getEnd() { return this->iter_ptr->value.end; }
+
+    // Этот метод возвращает значение, связанное с интервалом
+    Value& getValue() { return this->iter_ptr->value.value; }
+  };
+
+ private:
+  using node_type = Node<Key, entry_type>;
+
+  // Этот метод обходит только поддеревья, в которых могут быть пересечения.
+  // Если inclusive == true, то граница hi входит в запрос. Путь хранится в
+  // явном стеке, а не в рекурсии
+  void CollectOverlaps(const Key& lo, const Key& hi, bool inclusive,
+                       std::vector<iterator>& result);
+};
+
+/*
+  Публичные методы для взаимодействия с классом
+*/
+
+template <typename Key, typename Value>
+interval_map<Key, Value>::interval_map() : RBtree<Key, entry_type>() {}
+
+template <typename Key, typename Value>
+interval_map<Key, Value>::interval_map(const interval_map& other)
+    : RBtree<Key, entry_type>(other) {}
+
+template <typename Key, typename Value>
+interval_map<Key, Value>::interval_map(interval_map&& other) noexcept
+    : RBtree<Key, entry_type>(std::move(other)) {}
+
+template <typename Key, typename Value>
+interval_map<Key, Value>& interval_map<Key, Value>::operator=(
+    const interval_map& other) {
+  if (&other != this) {
+    interval_map<Key, Value> buf(other);
+    swap(buf);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value>
+interval_map<Key, Value>& interval_map<Key, Value>::operator=(
+    interval_map&& other) {
+  if (&other != this) {
+    swap(other);
+    other.clear();
+  }
+  return *this;
+}
+
+template <typename Key, typename Value>
+interval_map<Key, Value>::~interval_map() {}
+
+/*
+  ИТЕРАТОРЫ
+*/
+
+template <typename Key, typename Value>
+typename interval_map<Key, Value>::iterator interval_map<Key, Value>::begin() {
+  return iterator(this->MinNode());
+}
+
+template <typename Key, typename Value>
+typename interval_map<Key, Value>::iterator interval_map<Key, Value>::end() {
+  return iterator(this->MaxNode());
+}
+
+/*
+  РАЗМЕРЫ
+*/
+
+template <typename Key, typename Value>
+bool interval_map<Key, Value>::empty() {
+  return this->root == nullptr;
+}
+
+template <typename Key, typename Value>
+typename interval_map<Key, Value>::size_type interval_map<Key, Value>::size() {
+  return RBtree<Key, entry_type>::size();
+}
+
+/*
+  Публичные методы для изменения контейнера:
+*/
+
+template <typename Key, typename Value>
+void interval_map<Key, Value>::clear() {
+  RBtree<Key, entry_type>::clear();
+}
+
+template <typename Key, typename Value>
+typename interval_map<Key, Value>::iterator interval_map<Key, Value>::insert(
+    const Key& start, const Key& end, const Value& value) {
+  if (!(start < end)) {
+    throw std::invalid_argument("Interval is empty");
+  }
+  return iterator(this->insertTree(start, entry_type{end, end, value}));
+}
+
+template <typename Key, typename Value>
+void interval_map<Key, Value>::erase(iterator pos) {
+  RBtree<Key, entry_type>::erase(pos);
+}
+
+template <typename Key, typename Value>
+void interval_map<Key, Value>::swap(interval_map& other) {
+  RBtree<Key, entry_type>::swap(other);
+}
+
+/*
+  ПОИСК
+*/
+
+template <typename Key, typename Value>
+std::vector<typename interval_map<Key, Value>::iterator>
+interval_map<Key, Value>::overlapping(const Key& point) {
+  std::vector<iterator> result;
+  CollectOverlaps(point, point, true, result);
+  return result;
+}
+
+template <typename Key, typename Value>
+std::vector<typename interval_map<Key, Value>::iterator>
+interval_map<Key, Value>::overlapping(const Key& lo, const Key& hi) {
+  std::vector<iterator> result;
+  if (lo < hi) {
+    CollectOverlaps(lo, hi, false, result);
+  }
+  return result;
+}
+
+template <typename Key, typename Value>
+void interval_map<Key, Value>::CollectOverlaps(const Key& lo, const Key& hi,
+                                               bool inclusive,
+                                               std::vector<iterator>& result) {
+  // Итератор копируется из курсора, чтобы не искать корень для каждого узла
+  iterator cursor(this->root);
+  std::vector<node_type*> path;
+  node_type* node = this->root;
+  bool done = false;
+  while (!done) {
+    // В поддеревьях, где нет интервалов правее lo, спускаться незачем
+    while (node != nullptr && lo < node->value.max_end) {
+      path.push_back(node);
+      node = node->left;
+    }
+    if (path.empty()) {
+      done = true;
+    } else {
+      node = path.back();
+      path.pop_back();
+      // Узлы обходятся по возрастанию начала, все следующие начинаются не
+      // раньше hi
+      if (inclusive ? hi < node->key : !(node->key < hi)) {
+        done = true;
+      } else {
+        if (lo < node->value.end) {
+          cursor(node);
+          result.push_back(cursor);
+        }
+        node = node->right;
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_INTERVAL_MAP_H
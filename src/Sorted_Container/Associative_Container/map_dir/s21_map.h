@@ -4,9 +4,12 @@
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
+#include "../../Frozen_Container/frozen_map_dir/s21_frozen_map.h"
 #include "../../RBtree/s21_RBtree.h"
+#include "../../Serialization/s21_serialization.h"
 
 namespace s21 {
 template <typename Key, typename Value>
@@ -120,6 +123,30 @@ class map : public RBtree<Key, Value> {
   // Этот метод проверяет есть ли в контейнере элемент с таким ключом
   bool contains(const Key& key);
 
+  // Этот метод ищет сразу несколько ключей и записывает в out итераторы в
+  // порядке ключей. Для отсутствующего ключа итератор равен nullptr
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                      OutputIt out);
+
+  // Этот метод для каждого ключа записывает в out, есть ли он в контейнере
+  template <class ForwardIt, class OutputIt>
+  OutputIt contains_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                          OutputIt out);
+
+  // Этот метод создает неизменяемую копию словаря для быстрого поиска
+  frozen_map<Key, Value> freeze();
+
+  /*
+  СОХРАНЕНИЕ И ЗАГРУЗКА
+  */
+
+  // Этот метод сохраняет словарь в бинарный файл
+  void save(const std::string& path);
+
+  // Этот метод заменяет содержимое словаря данными из файла
+  void load(const std::string& path);
+
   class MapIterator : public RBtree<Key, Value>::Iterator {
    public:
     friend class map;
@@ -352,6 +379,50 @@ bool map<Key, Value>::contains(const Key& key) {
   return res;
 }
 
+template <typename Key, typename Value>
+template <class ForwardIt, class OutputIt>
+OutputIt map<Key, Value>::find_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                                     OutputIt out) {
+  // Итераторы копируются из курсора, чтобы не искать корень для каждого
+  iterator cursor(this->root);
+  for (Node<Key, Value>* node : this->findNodesBatch(keys_begin, keys_end)) {
+    cursor(node);
+    *out++ = cursor;
+  }
+  return out;
+}
+
+template <typename Key, typename Value>
+template <class ForwardIt, class OutputIt>
+OutputIt map<Key, Value>::contains_batch(ForwardIt keys_begin,
+                                         ForwardIt keys_end, OutputIt out) {
+  for (Node<Key, Value>* node : this->findNodesBatch(keys_begin, keys_end)) {
+    *out++ = node != nullptr;
+  }
+  return out;
+}
+
+template <typename Key, typename Value>
+frozen_map<Key, Value> map<Key, Value>::freeze() {
+  std::vector<Key> keys;
+  std::vector<Value> values;
+  this->ForEachNode([&keys, &values](Node<Key, Value>* node) {
+    keys.push_back(node->key);
+    values.push_back(node->value);
+  });
+  return frozen_map<Key, Value>(std::move(keys), std::move(values));
+}
+
+template <typename Key, typename Value>
+void map<Key, Value>::save(const std::string& path) {
+  SaveSortedFile(*this, path, kSortedFileValues | kSortedFileUnique);
+}
+
+template <typename Key, typename Value>
+void map<Key, Value>::load(const std::string& path) {
+  LoadSortedFile(*this, path, kSortedFileValues | kSortedFileUnique);
+}
+
 // Доп функции
 
 template <typename Key, typename Value>
@@ -0,0 +1,239 @@
+#ifndef S21_EYTZINGER_H
+#define S21_EYTZINGER_H
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Неизменяемый индекс ключей в раскладке Эйтцингера: ключи лежат в массиве
+// в порядке обхода дерева в ширину, потомки узла k находятся в ячейках 2k и
+// 2k + 1. Ячейка 0 не используется и обозначает конец
+template <typename Key>
+class Eytzinger {
+ public:
+  class Iterator;
+  using size_type = size_t;
+
+  /*
+  КОНСТРУКТОРЫ
+  */
+
+  // Конструктор по умолчанию
+  Eytzinger();
+
+  // Конструктор из отсортированных уникальных ключей
+  explicit Eytzinger(const std::vector<Key>& sorted_keys);
+
+  /*
+  ИТЕРАТОР
+  */
+
+  class Iterator {
+   protected:
+    const Eytzinger<Key>* owner;
+    size_type slot;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    // Конструктор по умолчанию
+    Iterator() : owner(nullptr), slot(0) {}
+
+    // Конструктор с указателем на таблицу и номером ячейки
+    Iterator(const Eytzinger<Key>* owner, size_type slot)
+        : owner(owner), slot(slot) {}
+
+    // Оператор префиксного инкремента
+    Iterator& operator++() {
+      slot = owner->NextSlot(slot);
+      return *this;
+    }
+
+    // Оператор постфиксного инкремента
+    Iterator operator++(int) {
+      Iterator buf(*this);
+      slot = owner->NextSlot(slot);
+      return buf;
+    }
+
+    // Оператор неравенства
+    bool operator!=(const Iterator& other) const { return slot != other.slot; }
+
+    // Оператор равенства
+    bool operator==(const Iterator& other) const { return slot == other.slot; }
+
+    // Этот метод возвращает ключ обьекта
+    const Key& getKey() const { return owner->keys[slot]; }
+
+    // Операторы доступа к ключу
+    const Key& operator*() const { return owner->keys[slot]; }
+    const Key* operator->() const { return &owner->keys[slot]; }
+
+    // Этот метод возвращает номер ячейки в раскладке
+    size_type getSlot() const { return slot; }
+  };
+
+  /*
+  ПОИСК
+  */
+
+  // Этот метод возвращает ячейку первого ключа, который не меньше key,
+  // или 0, если такого нет. Спуск по дереву идет без ветвлений
+  size_type LowerBoundSlot(const Key& key) const;
+
+  // Этот метод возвращает ячейку ключа или 0, если его нет
+  size_type FindSlot(const Key& key) const;
+
+  // Этот метод возвращает ячейку наименьшего ключа
+  size_type FirstSlot() const;
+
+  // Этот метод возвращает ячейку следующего по порядку ключа
+  size_type NextSlot(size_type slot) const;
+
+  // Этот метод возвращает количество ключей
+  size_type size() const;
+
+  // Этот метод проверяет, пуста ли таблица
+  bool empty() const;
+
+ protected:
+  // Этот метод переставляет отсортированный массив в раскладку Эйтцингера
+  template <typename T>
+  static std::vector<T> ToLayout(std::vector<T>&& sorted);
+
+  std::vector<Key> keys;
+
+ private:
+  // Через столько уровней вниз потомки узла k занимают ячейки 16k..16k + 15
+  static constexpr size_type kPrefetchStride = 16;
+
+  template <typename T>
+  static void FillLayout(std::vector<T>& sorted, std::vector<T>& layout,
+                         size_type& rank, size_type slot);
+
+  // Этот метод сдвигает ячейку вверх на столько уровней, сколько младших
+  // единичных битов у нее было, плюс один
+  static size_type ClimbSlot(size_type slot);
+};
+
+/*
+  КОНСТРУКТОРЫ
+*/
+
+template <typename Key>
+Eytzinger<Key>::Eytzinger() : keys(1) {}
+
+template <typename Key>
+Eytzinger<Key>::Eytzinger(const std::vector<Key>& sorted_keys)
+    : keys(ToLayout(std::vector<Key>(sorted_keys))) {}
+
+/*
+  ПОИСК
+*/
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::LowerBoundSlot(
+    const Key& key) const {
+  const size_type count = size();
+  const Key* data = keys.data();
+  size_type slot = 1;
+  while (slot <= count) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (slot * kPrefetchStride <= count) {
+      __builtin_prefetch(data + slot * kPrefetchStride);
+    }
+#endif
+    slot = 2 * slot + static_cast<size_type>(key > data[slot]);
+  }
+  return ClimbSlot(slot);
+}
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::FindSlot(
+    const Key& key) const {
+  size_type slot = LowerBoundSlot(key);
+  if (slot != 0 && keys[slot] > key) {
+    slot = 0;
+  }
+  return slot;
+}
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::FirstSlot() const {
+  size_type slot = 0;
+  if (!empty()) {
+    slot = 1;
+    while (2 * slot <= size()) {
+      slot = 2 * slot;
+    }
+  }
+  return slot;
+}
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::NextSlot(
+    size_type slot) const {
+  if (2 * slot + 1 <= size()) {
+    slot = 2 * slot + 1;
+    while (2 * slot <= size()) {
+      slot = 2 * slot;
+    }
+  } else {
+    slot = ClimbSlot(slot);
+  }
+  return slot;
+}
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::size() const {
+  return keys.size() - 1;
+}
+
+template <typename Key>
+bool Eytzinger<Key>::empty() const {
+  return keys.size() == 1;
+}
+
+/*
+  ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
+*/
+
+template <typename Key>
+template <typename T>
+std::vector<T> Eytzinger<Key>::ToLayout(std::vector<T>&& sorted) {
+  std::vector<T> layout(sorted.size() + 1);
+  size_type rank = 0;
+  FillLayout(sorted, layout, rank, 1);
+  return layout;
+}
+
+template <typename Key>
+template <typename T>
+void Eytzinger<Key>::FillLayout(std::vector<T>& sorted, std::vector<T>& layout,
+                                size_type& rank, size_type slot) {
+  if (slot < layout.size()) {
+    FillLayout(sorted, layout, rank, 2 * slot);
+    layout[slot] = std::move(sorted[rank++]);
+    FillLayout(sorted, layout, rank, 2 * slot + 1);
+  }
+}
+
+template <typename Key>
+typename Eytzinger<Key>::size_type Eytzinger<Key>::ClimbSlot(size_type slot) {
+#if defined(__GNUC__) || defined(__clang__)
+  slot >>= __builtin_ffsll(static_cast<long long>(~slot));
+#else
+  while (slot & 1) {
+    slot >>= 1;
+  }
+  slot >>= 1;
+#endif
+  return slot;
+}
+
+#endif  // S21_EYTZINGER_H
@@ -0,0 +1,5 @@
+#ifndef S21_CONTAINERS_SRC_FROZEN_CONTAINER_H_
+#define S21_CONTAINERS_SRC_FROZEN_CONTAINER_H_
+#include "frozen_map_dir/s21_frozen_map.h"
+#include "frozen_set_dir/s21_frozen_set.h"
+#endif
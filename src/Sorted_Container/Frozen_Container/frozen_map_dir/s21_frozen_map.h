@@ -0,0 +1,147 @@
+#ifndef S21_FROZEN_MAP_H
+#define S21_FROZEN_MAP_H
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../Eytzinger/s21_eytzinger.h"
+
+namespace s21 {
+// Неизменяемый словарь, который получается из map::freeze(). Ключи хранятся
+// в раскладке Эйтцингера, значения - в параллельном массиве
+template <typename Key, typename Value>
+class frozen_map : public Eytzinger<Key> {
+ public:
+  class FrozenMapIterator;
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using iterator = FrozenMapIterator;
+  using const_iterator = FrozenMapIterator;
+  using size_type = size_t;
+
+  /*
+  Публичные методы для взаимодействия с классом
+  */
+
+  // Конструктор по умолчанию
+  frozen_map();
+
+  // Конструктор из отсортированных уникальных ключей и значений к ним
+  frozen_map(std::vector<Key> sorted_keys, std::vector<Value> sorted_values);
+
+  /*
+  Публичные методы для доступа к элементам класса:
+  */
+
+  // Этот метод позволяет получить доступ к элементам по ключу.
+  // Если элемента нет выбрасывает исключение
+  const Value& at(const Key& key) const;
+
+  /*
+  ИТЕРАТОРЫ
+  */
+
+  // Этот метод возвращает итератор на наименьший ключ
+  iterator begin() const;
+
+  // Этот метод возвращает итератор за последним элементом
+  iterator end() const;
+
+  /*
+  ПОИСК
+  */
+
+  // Этот метод возвращает итератор на элемент или end(), если его нет
+  iterator find(const Key& key) const;
+
+  // Этот метод проверяет есть ли в контейнере элемент с таким ключом
+  bool contains(const Key& key) const;
+
+  // Этот метод возвращает итератор на первый элемент, который не меньше ключа
+  iterator lower_bound(const Key& key) const;
+
+  // Пары ключ-значение собираются при разыменовании и возвращаются по
+  // значению, поэтому итератор только входной
+  class FrozenMapIterator : public Eytzinger<Key>::Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = frozen_map::value_type;
+    using pointer = void;
+    using reference = value_type;
+
+    FrozenMapIterator() : Eytzinger<Key>::Iterator(){};
+    FrozenMapIterator(const frozen_map* owner, size_type slot)
+        : Eytzinger<Key>::Iterator(owner, slot){};
+
+    // Этот метод возвращает значение обьекта
+    const Value& getValue() const {
+      return static_cast<const frozen_map*>(this->owner)->values[this->slot];
+    }
+
+    value_type operator*() const {
+      return value_type(this->getKey(), getValue());
+    }
+
+    // Указателя на пару нет, доступ к ключу через -> был бы ошибкой
+    const Key* operator->() const = delete;
+  };
+
+ private:
+  std::vector<Value> values;
+};
+
+template <typename Key, typename Value>
+frozen_map<Key, Value>::frozen_map() : Eytzinger<Key>(), values(1) {}
+
+template <typename Key, typename Value>
+frozen_map<Key, Value>::frozen_map(std::vector<Key> sorted_keys,
+                                   std::vector<Value> sorted_values) {
+  if (sorted_keys.size() != sorted_values.size()) {
+    throw std::invalid_argument("Keys and values sizes don't match");
+  }
+  this->keys = this->ToLayout(std::move(sorted_keys));
+  values = this->ToLayout(std::move(sorted_values));
+}
+
+template <typename Key, typename Value>
+const Value& frozen_map<Key, Value>::at(const Key& key) const {
+  size_type slot = this->FindSlot(key);
+  if (slot == 0) {
+    throw std::out_of_range("Key not find");
+  }
+  return values[slot];
+}
+
+template <typename Key, typename Value>
+typename frozen_map<Key, Value>::iterator frozen_map<Key, Value>::begin()
+    const {
+  return iterator(this, this->FirstSlot());
+}
+
+template <typename Key, typename Value>
+typename frozen_map<Key, Value>::iterator frozen_map<Key, Value>::end() const {
+  return iterator(this, 0);
+}
+
+template <typename Key, typename Value>
+typename frozen_map<Key, Value>::iterator frozen_map<Key, Value>::find(
+    const Key& key) const {
+  return iterator(this, this->FindSlot(key));
+}
+
+template <typename Key, typename Value>
+bool frozen_map<Key, Value>::contains(const Key& key) const {
+  return this->FindSlot(key) != 0;
+}
+
+template <typename Key, typename Value>
+typename frozen_map<Key, Value>::iterator frozen_map<Key, Value>::lower_bound(
+    const Key& key) const {
+  return iterator(this, this->LowerBoundSlot(key));
+}
+
+}  // namespace s21
+
+#endif  // S21_FROZEN_MAP_H
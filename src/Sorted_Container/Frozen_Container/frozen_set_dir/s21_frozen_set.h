@@ -0,0 +1,36 @@
+#ifndef S21_FROZEN_SET_H
+#define S21_FROZEN_SET_H
+
+#include <vector>
+
+#include "../../Eytzinger/s21_eytzinger.h"
+
+namespace s21 {
+// Неизменяемое множество, которое получается из set::freeze()
+template <typename Key>
+class frozen_set : public Eytzinger<Key> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using iterator = typename Eytzinger<Key>::Iterator;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  frozen_set() : Eytzinger<Key>(){};
+  explicit frozen_set(const std::vector<Key>& sorted_keys)
+      : Eytzinger<Key>(sorted_keys){};
+
+  iterator begin() const { return iterator(this, this->FirstSlot()); }
+  iterator end() const { return iterator(this, 0); }
+
+  iterator find(const Key& key) const {
+    return iterator(this, this->FindSlot(key));
+  }
+  bool contains(const Key& key) const { return this->FindSlot(key) != 0; }
+  iterator lower_bound(const Key& key) const {
+    return iterator(this, this->LowerBoundSlot(key));
+  }
+};
+}  // namespace s21
+
+#endif  // S21_FROZEN_SET_H
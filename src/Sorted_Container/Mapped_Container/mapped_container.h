@@ -0,0 +1,5 @@
+#ifndef S21_CONTAINERS_SRC_MAPPED_CONTAINER_H_
+#define S21_CONTAINERS_SRC_MAPPED_CONTAINER_H_
+#include "mapped_map_dir/s21_mapped_map.h"
+#include "mapped_set_dir/s21_mapped_set.h"
+#endif
@@ -0,0 +1,72 @@
+#ifndef S21_MAPPED_MAP_H
+#define S21_MAPPED_MAP_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "../../Serialization/s21_serialization.h"
+
+namespace s21 {
+// Словарь только для чтения поверх файла, сохраненного map::save(). Поиск
+// идет двоичным поиском прямо по отображенному в память массиву ключей.
+// Конструктор один раз проверяет, что ключи возрастают, и бросает
+// std::invalid_argument, если это не так
+template <typename Key, typename Value>
+class mapped_map {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+
+  // Конструктор, который отображает файл в память
+  explicit mapped_map(const std::string& path)
+      : view(path, kSortedFileValues | kSortedFileUnique) {}
+
+  // Этот метод возвращает количество элементов
+  size_type size() const { return view.count(); }
+
+  // Этот метод проверяет на пустоту контейнер
+  bool empty() const { return view.count() == 0; }
+
+  // Этот метод возвращает количество ключей меньше key, то есть позицию
+  // первого ключа, который не меньше key, или size(), если такого нет.
+  // Позиция передается в key() и value()
+  size_type rank(const Key& key) const {
+    return std::lower_bound(view.keys(), view.keys() + view.count(), key) -
+           view.keys();
+  }
+
+  // Этот метод возвращает указатель на значение или nullptr
+  const Value* find(const Key& key) const {
+    size_type pos = rank(key);
+    const Value* result = nullptr;
+    if (pos != size() && !(key < view.keys()[pos])) {
+      result = view.values() + pos;
+    }
+    return result;
+  }
+
+  // Этот метод проверяет есть ли в контейнере элемент с таким ключом
+  bool contains(const Key& key) const { return find(key) != nullptr; }
+
+  // Этот метод позволяет получить доступ к элементам по ключу.
+  // Если элемента нет выбрасывает исключение
+  const Value& at(const Key& key) const {
+    const Value* result = find(key);
+    if (result == nullptr) {
+      throw std::out_of_range("Key not find");
+    }
+    return *result;
+  }
+
+  // Эти методы возвращают ключ и значение на позиции в порядке возрастания
+  const Key& key(size_type pos) const { return view.keys()[pos]; }
+  const Value& value(size_type pos) const { return view.values()[pos]; }
+
+ private:
+  SortedFileView<Key, Value> view;
+};
+}  // namespace s21
+
+#endif  // S21_MAPPED_MAP_H
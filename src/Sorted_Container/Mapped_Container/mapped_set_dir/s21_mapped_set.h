@@ -0,0 +1,59 @@
+#ifndef S21_MAPPED_SET_H
+#define S21_MAPPED_SET_H
+
+#include <algorithm>
+#include <string>
+
+#include "../../Serialization/s21_serialization.h"
+
+namespace s21 {
+// Множество только для чтения поверх файла, сохраненного set::save() или
+// multiset::save(). Конструктор один раз проверяет порядок ключей (у файла
+// set еще и отсутствие повторов) и бросает std::invalid_argument
+template <typename Key>
+class mapped_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = size_t;
+
+  // Конструктор, который отображает файл в память
+  explicit mapped_set(const std::string& path) : view(path, 0) {}
+
+  // Этот метод возвращает количество элементов
+  size_type size() const { return view.count(); }
+
+  // Этот метод проверяет на пустоту контейнер
+  bool empty() const { return view.count() == 0; }
+
+  // Этот метод возвращает первый ключ, который не меньше key, или end()
+  const Key* lower_bound(const Key& key) const {
+    return std::lower_bound(begin(), end(), key);
+  }
+
+  // Этот метод возвращает первый ключ, который больше key, или end()
+  const Key* upper_bound(const Key& key) const {
+    return std::upper_bound(begin(), end(), key);
+  }
+
+  // Этот метод проверяет есть ли в контейнере такой ключ
+  bool contains(const Key& key) const {
+    const Key* found = lower_bound(key);
+    return found != end() && !(key < *found);
+  }
+
+  // Этот метод возвращает количество копий ключа
+  size_type count(const Key& key) const {
+    return upper_bound(key) - lower_bound(key);
+  }
+
+  // Эти методы возвращают границы отсортированного массива ключей
+  const Key* begin() const { return view.keys(); }
+  const Key* end() const { return view.keys() + view.count(); }
+
+ private:
+  SortedFileView<Key, Key> view;
+};
+}  // namespace s21
+
+#endif  // S21_MAPPED_SET_H
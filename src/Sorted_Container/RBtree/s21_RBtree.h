@@ -1,8 +1,15 @@
 #ifndef S21_READ_BLACK_TREE_H
 #define S21_READ_BLACK_TREE_H
 
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 enum RBTColor { Black, Red };
 
@@ -16,6 +23,17 @@ struct Node {
   RBTColor color;
 };
 
+// Этот шаблон позволяет контейнерам-наследникам хранить в узлах
+// дополнительные данные о поддереве. Метод update вызывается для узлов,
+// у которых изменились потомки при поворотах, а при enabled == true еще и
+// для всех предков вставленного или удаленного узла. По умолчанию ничего не
+// делает
+template <typename Key, typename Value>
+struct RBtreeAugment {
+  static constexpr bool enabled = false;
+  static void update(Node<Key, Value>*) {}
+};
+
 template <typename Key, typename Value>
 class RBtree {
  public:
@@ -45,7 +63,9 @@ class RBtree {
   МЕТОДЫ ОТЧИСТКИ И УДАЛЕНИЯ
   */
 
-  // Этот метод рекурсивно освобождает память, занятую узлами дерева
+  // Этот метод освобождает память, занятую узлами поддерева. Обход идет
+  // по указателям на родителя без рекурсии, поэтому глубина дерева не
+  // ограничена размером стека
   void FreeNode(Node<Key, Value>* node);
 
   // Этот метод очищает все узлы в дереве
@@ -74,22 +94,53 @@ class RBtree {
   ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ
   */
 
-  // Этот метод отвечает за вставку нового узла в дерево
-  void insertTree(const Key& key, const Value& value);
+  // Этот метод отвечает за вставку нового узла в дерево и возвращает
+  // указатель на вставленный узел
+  Node<Key, Value>* insertTree(const Key& key, const Value& value);
 
   // Этот метод обменивает содержимое текущего дерева с другим деревом
   void swap(RBtree& other);
 
-  // Этот метод создает глубокую копию поддерева, начиная с указанного узла
+  // Этот метод создает глубокую копию поддерева, начиная с указанного узла.
+  // Исходное и новое поддеревья обходятся синхронно без рекурсии. Если
+  // копирование ключа или значения бросает исключение, уже созданные узлы
+  // освобождаются
   Node<Key, Value>* Copytree(Node<Key, Value>* ptr,
                              Node<Key, Value>* parent_ptr);
 
+  // Этот метод копирует поддерево, отдавая независимые поддеревья верхних
+  // уровней отдельным потокам. Всего используется не больше threads потоков.
+  // Исключение из любого потока пробрасывается вызывающему, частичная копия
+  // освобождается
+  Node<Key, Value>* CopytreeParallel(Node<Key, Value>* ptr,
+                                     Node<Key, Value>* parent_ptr,
+                                     unsigned threads);
+
+  // Этот метод заменяет содержимое дерева копией other, созданной в threads
+  // потоках
+  void CopyFrom(const RBtree& other, unsigned threads);
+
+  // Этот метод создает копию одного узла без потомков
+  static Node<Key, Value>* CopyNode(const Node<Key, Value>* ptr,
+                                    Node<Key, Value>* parent_ptr);
+
   // Этот метод возвращает указатель на первый узел по ключу
   Node<Key, Value>* findNodeByKey(const Key key);
 
   // Этот метод возвращает указатель на последний узел по ключу
   Node<Key, Value>* findLastMatch(const Key key);
 
+  // Этот метод ищет узлы для набора ключей, ведя несколько спусков
+  // одновременно. Результат возвращается в порядке ключей, nullptr для
+  // отсутствующих. Ключи читаются прямо из диапазона без копирования,
+  // поэтому он должен допускать повторный проход
+  template <class ForwardIt>
+  std::vector<Node<Key, Value>*> findNodesBatch(ForwardIt first,
+                                                ForwardIt last);
+
+  // Этот метод подгружает узел в кэш заранее, до обращения к нему
+  static void PrefetchNode(const Node<Key, Value>* node);
+
   // Оператор [] для доступа к значению
   Value operator[](const Key key);
 
@@ -97,15 +148,34 @@ class RBtree {
   БАЛАНСИРОВКА ДЕРЕВА
   */
 
-  // Этот метод занимается балансировкой дерева
+  // Этот метод восстанавливает свойства красно-черного дерева после
+  // вставки красного узла
   void rebalanceRBtree(Node<Key, Value>* nodeptr);
 
+  // Этот метод восстанавливает свойства дерева после удаления черного узла.
+  // nodeptr встал на место удаленного узла и может быть nullptr, поэтому
+  // его родитель передается отдельно
+  void rebalanceErase(Node<Key, Value>* nodeptr, Node<Key, Value>* parent);
+
+  // Этот метод ставит поддерево new_node на место узла old_node
+  void ReplaceNode(Node<Key, Value>* old_node, Node<Key, Value>* new_node);
+
+  // Этот метод пересчитывает дополнительные данные от узла до корня
+  static void UpdateAugmentPath(Node<Key, Value>* node);
+
   // Этот метод выполняет правый поворот вокруг узла x в дереве
   void right_rotate(Node<Key, Value>* x);
 
   // Этот метод выполняет левый поворот вокруг узла x в дереве
   void left_rotate(Node<Key, Value>* x);
 
+  // Этот метод строит поддерево из элементов [lo, hi). Узлы на глубине
+  // red_depth красные, остальные черные
+  static Node<Key, Value>* BuildSubtree(const Key* keys, const Value* values,
+                                        size_type lo, size_type hi,
+                                        size_type depth, size_type red_depth,
+                                        Node<Key, Value>* parent);
+
   /*
   ИТЕРАТОР
   */
@@ -179,12 +249,22 @@ class RBtree {
   // Этот метод возвращает общее количество узлов в дереве
   size_type size();
 
-  // Этот метод возвращает общее количество узлов в поддереве
-  size_t RecursiveSize(Node<Key, Value>* node);
+  // Этот метод возвращает общее количество узлов в поддереве. Обход идет
+  // по указателям на родителя без рекурсии
+  size_t SubtreeSize(Node<Key, Value>* node);
 
   // Этот метод проверяет, является ли дерево пустым.
   bool empty();
 
+  // Этот метод обходит узлы в порядке возрастания ключей без рекурсии
+  template <class Func>
+  void ForEachNode(Func func);
+
+  // Этот метод строит сбалансированное дерево из отсортированных массивов
+  // за линейное время. Старое содержимое удаляется. Файлы читаются и
+  // пишутся в модуле Serialization через этот метод и ForEachNode
+  void BuildFromSorted(const Key* keys, const Value* values, size_type count);
+
  protected:
   Node<Key, Value>* root;
 };
@@ -220,10 +300,26 @@ RBtree<Key, Value>::~RBtree() {
 
 template <typename Key, typename Value>
 void RBtree<Key, Value>::FreeNode(Node<Key, Value>* node) {
-  if (node != nullptr) {
-    FreeNode(node->left);
-    FreeNode(node->right);
-    delete node;
+  Node<Key, Value>* stop = (node != nullptr) ? node->parent : nullptr;
+  // Спускаемся до листа, удаляем его и возвращаемся к родителю
+  while (node != nullptr) {
+    if (node->left != nullptr) {
+      node = node->left;
+    } else if (node->right != nullptr) {
+      node = node->right;
+    } else {
+      // Ссылку родителя на лист нужно снять до удаления листа
+      Node<Key, Value>* buf_parent = node->parent;
+      if (buf_parent != stop) {
+        if (buf_parent->left == node) {
+          buf_parent->left = nullptr;
+        } else {
+          buf_parent->right = nullptr;
+        }
+      }
+      delete node;
+      node = (buf_parent != stop) ? buf_parent : nullptr;
+    }
   }
 }
 
@@ -237,60 +333,39 @@ void RBtree<Key, Value>::clear() {
 
 template <typename Key, typename Value>
 void RBtree<Key, Value>::erase(RBtree<Key, Value>::Iterator pos) {
+  Node<Key, Value>* node = pos.iter_ptr;
+  // Узел, который уходит со своего места: сам node или его преемник, если
+  // у node два потомка. Узлы переставляются, а не копируются, поэтому
+  // итераторы на остальные элементы остаются верными
+  RBTColor removed_color = node->color;
   Node<Key, Value>* son;
-  // Случай если нет предков
-  if (pos.iter_ptr->right == nullptr && pos.iter_ptr->left == nullptr) {
-    if (root != pos.iter_ptr) {
-      if (pos.iter_ptr->parent->left == pos.iter_ptr) {
-        pos.iter_ptr->parent->left = nullptr;
-      } else {
-        pos.iter_ptr->parent->right = nullptr;
-      }
-    } else {
-      root = nullptr;
-    }
-  }  // Случай если только один предок
-  else if (pos.iter_ptr->right == nullptr || pos.iter_ptr->left == nullptr) {
-    if (pos.iter_ptr->right != nullptr) {
-      son = pos.iter_ptr->right;
-    } else {
-      son = pos.iter_ptr->left;
-    }
-    if (pos.iter_ptr->parent != nullptr) {
-      if (pos.iter_ptr->parent->right == pos.iter_ptr) {
-        pos.iter_ptr->parent->right = son;
-      } else {
-        pos.iter_ptr->parent->left = son;
-      }
-      son->parent = pos.iter_ptr->parent;
-    } else {
-      root = son;
-    }
-  }  // Случай если два предка
-  else {
-    son = pos.iter_ptr->left;
-    if (pos.iter_ptr->parent != nullptr) {
-      if (pos.iter_ptr->parent->right == pos.iter_ptr) {
-        pos.iter_ptr->parent->right = son;
-      } else {
-        pos.iter_ptr->parent->left = son;
-      }
-      son->parent = pos.iter_ptr->parent;
-    } else {
-      root = son;
-      son->parent = nullptr;
-    }
-    if (son->right != nullptr) {
-      Node<Key, Value>* buf = MinNode(pos.iter_ptr->right);
-      buf->left = son->right;
-      son->right = pos.iter_ptr->right;
-      son->right->parent = son;
-      buf->left->parent = buf;
+  Node<Key, Value>* son_parent;
+  if (node->left == nullptr || node->right == nullptr) {
+    son = (node->left != nullptr) ? node->left : node->right;
+    son_parent = node->parent;
+    ReplaceNode(node, son);
+  } else {
+    Node<Key, Value>* next = MinNode(node->right);
+    removed_color = next->color;
+    son = next->right;
+    if (next->parent == node) {
+      son_parent = next;
     } else {
-      son->right = pos.iter_ptr->right;
+      son_parent = next->parent;
+      ReplaceNode(next, son);
+      next->right = node->right;
+      next->right->parent = next;
     }
+    ReplaceNode(node, next);
+    next->left = node->left;
+    next->left->parent = next;
+    next->color = node->color;
   }
-  delete pos.iter_ptr;
+  UpdateAugmentPath(son_parent);
+  if (removed_color == Black) {
+    rebalanceErase(son, son_parent);
+  }
+  delete node;
 }
 
 /*
@@ -332,7 +407,8 @@ Node<Key, Value>* RBtree<Key, Value>::MaxNode() {
 */
 
 template <typename Key, typename Value>
-void RBtree<Key, Value>::insertTree(const Key& key, const Value& value) {
+Node<Key, Value>* RBtree<Key, Value>::insertTree(const Key& key,
+                                                 const Value& value) {
   Node<Key, Value>* new_elem = new Node<Key, Value>;
   new_elem->key = key;
   new_elem->value = value;
@@ -360,9 +436,10 @@ void RBtree<Key, Value>::insertTree(const Key& key, const Value& value) {
       buf_parent->right = new_elem;
     }
   }
-  if (new_elem != root) {
-    rebalanceRBtree(new_elem);
-  }
+  // Поворотам при балансировке нужны уже пересчитанные данные потомков
+  UpdateAugmentPath(new_elem);
+  rebalanceRBtree(new_elem);
+  return new_elem;
 }
 
 template <typename Key, typename Value>
@@ -373,15 +450,101 @@ void RBtree<Key, Value>::swap(RBtree<Key, Value>& other) {
 template <typename Key, typename Value>
 Node<Key, Value>* RBtree<Key, Value>::Copytree(Node<Key, Value>* ptr,
                                                Node<Key, Value>* parent_ptr) {
-  Node<Key, Value>* new_node = nullptr;
+  Node<Key, Value>* new_root = nullptr;
   if (ptr != nullptr) {
-    new_node = new Node<Key, Value>;
-    new_node->color = ptr->color;
+    new_root = CopyNode(ptr, parent_ptr);
+    Node<Key, Value>* src = ptr;
+    Node<Key, Value>* dst = new_root;
+    // Спускаемся в еще не скопированного потомка, а когда оба потомка
+    // скопированы, поднимаемся по обоим деревьям одновременно. Узел
+    // привязывается к родителю только после успешного копирования, поэтому
+    // частичная копия всегда остается деревом
+    try {
+      while (src != nullptr) {
+        if (src->left != nullptr && dst->left == nullptr) {
+          dst->left = CopyNode(src->left, dst);
+          src = src->left;
+          dst = dst->left;
+        } else if (src->right != nullptr && dst->right == nullptr) {
+          dst->right = CopyNode(src->right, dst);
+          src = src->right;
+          dst = dst->right;
+        } else if (src == ptr) {
+          src = nullptr;
+        } else {
+          src = src->parent;
+          dst = dst->parent;
+        }
+      }
+    } catch (...) {
+      FreeNode(new_root);
+      throw;
+    }
+  }
+  return new_root;
+}
+
+template <typename Key, typename Value>
+Node<Key, Value>* RBtree<Key, Value>::CopytreeParallel(
+    Node<Key, Value>* ptr, Node<Key, Value>* parent_ptr, unsigned threads) {
+  Node<Key, Value>* new_node = nullptr;
+  if (threads <= 1 || ptr == nullptr) {
+    new_node = Copytree(ptr, parent_ptr);
+  } else {
+    new_node = CopyNode(ptr, parent_ptr);
+    unsigned left_threads = threads / 2;
+    std::exception_ptr error;
+    try {
+      std::future<Node<Key, Value>*> left_copy =
+          std::async(std::launch::async, [this, ptr, new_node, left_threads]() {
+            return CopytreeParallel(ptr->left, new_node, left_threads);
+          });
+      // Левую копию нужно дождаться, даже если правая упала
+      try {
+        new_node->right =
+            CopytreeParallel(ptr->right, new_node, threads - left_threads);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      try {
+        new_node->left = left_copy.get();
+      } catch (...) {
+        if (!error) error = std::current_exception();
+      }
+    } catch (...) {
+      // Не удалось запустить поток
+      error = std::current_exception();
+    }
+    if (error) {
+      FreeNode(new_node);
+      std::rethrow_exception(error);
+    }
+  }
+  return new_node;
+}
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::CopyFrom(const RBtree& other, unsigned threads) {
+  if (&other != this) {
+    clear();
+    root = CopytreeParallel(other.root, nullptr, threads);
+  }
+}
+
+template <typename Key, typename Value>
+Node<Key, Value>* RBtree<Key, Value>::CopyNode(const Node<Key, Value>* ptr,
+                                               Node<Key, Value>* parent_ptr) {
+  Node<Key, Value>* new_node = new Node<Key, Value>;
+  new_node->color = ptr->color;
+  new_node->parent = parent_ptr;
+  new_node->left = nullptr;
+  new_node->right = nullptr;
+  try {
     new_node->key = ptr->key;
     new_node->value = ptr->value;
-    new_node->parent = parent_ptr;
-    new_node->left = Copytree(ptr->left, new_node);
-    new_node->right = Copytree(ptr->right, new_node);
+  } catch (...) {
+    delete new_node;
+    throw;
   }
   return new_node;
 }
@@ -422,6 +585,72 @@ Node<Key, Value>* RBtree<Key, Value>::findLastMatch(const Key key) {
   return res;
 }
 
+template <typename Key, typename Value>
+template <class ForwardIt>
+std::vector<Node<Key, Value>*> RBtree<Key, Value>::findNodesBatch(
+    ForwardIt first, ForwardIt last) {
+  static_assert(
+      std::is_base_of_v<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<ForwardIt>::iterator_category>,
+      "Batch lookup reads keys in place and needs a multi-pass range");
+  std::vector<Node<Key, Value>*> result(std::distance(first, last), nullptr);
+  // Каждая дорожка ведет свой спуск. За один проход по дорожкам каждая
+  // опускается на уровень и заранее подгружает следующий узел, который
+  // понадобится ей только через kLanes шагов. Так промахи кэша независимых
+  // спусков перекрываются, а не идут друг за другом. Ключи не сортируются:
+  // общий префикс соседних ключей сделал бы спуски зависимыми друг от друга
+  constexpr size_type kLanes = 8;
+  size_type probe[kLanes];
+  ForwardIt lane_key[kLanes];
+  Node<Key, Value>* lane_node[kLanes];
+  size_type active = 0;
+  size_type next = 0;
+  for (; active < kLanes && first != last; ++active, ++next, ++first) {
+    probe[active] = next;
+    lane_key[active] = first;
+    lane_node[active] = this->root;
+  }
+  while (active != 0) {
+    size_type lane = 0;
+    while (lane < active) {
+      Node<Key, Value>* buf = lane_node[lane];
+      const Key& key = *lane_key[lane];
+      if (buf != nullptr && buf->key != key) {
+        buf = (buf->key > key) ? buf->left : buf->right;
+        PrefetchNode(buf);
+        lane_node[lane] = buf;
+        ++lane;
+      } else {
+        result[probe[lane]] = buf;
+        if (first != last) {
+          // Освободившаяся дорожка берет следующий ключ
+          probe[lane] = next++;
+          lane_key[lane] = first++;
+          lane_node[lane] = this->root;
+          ++lane;
+        } else {
+          // Ключи кончились: на место дорожки встает последняя активная
+          --active;
+          probe[lane] = probe[active];
+          lane_key[lane] = lane_key[active];
+          lane_node[lane] = lane_node[active];
+        }
+      }
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::PrefetchNode(const Node<Key, Value>* node) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(node);
+#else
+  (void)node;
+#endif
+}
+
 template <typename Key, typename Value>
 Value RBtree<Key, Value>::operator[](const Key key) {
   return findNodeByKey(key)->value;
@@ -429,49 +658,127 @@ Value RBtree<Key, Value>::operator[](const Key key) {
 
 template <typename Key, typename Value>
 void RBtree<Key, Value>::rebalanceRBtree(Node<Key, Value>* nodeptr) {
-  Node<Key, Value>* father = nodeptr->parent;
-  if (father == nullptr) {
-    return;
-  }
-  if (father->parent != nullptr) {
-    Node<Key, Value>* uncle = (father->parent->right != father)
-                                  ? father->parent->right
-                                  : father->parent->left;
-    if (uncle != nullptr && father->parent != this->root &&
-        father->color == Red && uncle->color == Red) {
-      father->parent->color = Red;
+  // Отсутствующий потомок считается черным
+  while (nodeptr->parent != nullptr && nodeptr->parent->color == Red &&
+         nodeptr->parent->parent != nullptr) {
+    Node<Key, Value>* father = nodeptr->parent;
+    Node<Key, Value>* grand = father->parent;
+    bool father_is_left = (grand->left == father);
+    Node<Key, Value>* uncle = father_is_left ? grand->right : grand->left;
+    if (uncle != nullptr && uncle->color == Red) {
+      // Красный дядя: перекрашиваем и поднимаем проблему к деду
       father->color = Black;
       uncle->color = Black;
-      rebalanceRBtree(father->parent);
-    } else if (uncle != nullptr && father->color == Red &&
-               uncle->color == Black && father->parent->left->left == nodeptr) {
-      father->parent->color = Red;
-      father->color = Black;
-      right_rotate(father->parent);
-      rebalanceRBtree(father->right->right);
-    } else if (uncle != nullptr && father->color == Red &&
-               uncle->color == Black &&
-               father->parent->left->right == nodeptr) {
-      nodeptr->color = Black;
-      father->parent->color = Red;
-      left_rotate(father);
-      right_rotate(nodeptr->parent);
-      rebalanceRBtree(nodeptr->right->right);
-    } else if (uncle != nullptr && father->color == Red &&
-               uncle->color == Black &&
-               father->parent->right->right == nodeptr) {
-      father->parent->color = Red;
+      grand->color = Red;
+      nodeptr = grand;
+    } else {
+      // Черный дядя: приводим узел на внешнюю сторону и поворачиваем деда
+      if (father_is_left && nodeptr == father->right) {
+        left_rotate(father);
+        father = nodeptr;
+      } else if (!father_is_left && nodeptr == father->left) {
+        right_rotate(father);
+        father = nodeptr;
+      }
       father->color = Black;
-      left_rotate(father->parent);
-      rebalanceRBtree(father->left);
-    } else if (uncle != nullptr && father->color == Red &&
-               uncle->color == Black &&
-               father->parent->right->left == nodeptr) {
-      father->parent->color = Red;
-      nodeptr->color = Black;
-      right_rotate(father);
-      left_rotate(nodeptr->parent);
-      rebalanceRBtree(nodeptr->left->left);
+      grand->color = Red;
+      if (father_is_left) {
+        right_rotate(grand);
+      } else {
+        left_rotate(grand);
+      }
+      // Вершина поддерева теперь черная, выше ничего не меняется
+      nodeptr = this->root;
+    }
+  }
+  this->root->color = Black;
+}
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::rebalanceErase(Node<Key, Value>* nodeptr,
+                                        Node<Key, Value>* parent) {
+  auto is_black = [](Node<Key, Value>* node) {
+    return node == nullptr || node->color == Black;
+  };
+  // На пути через nodeptr не хватает одного черного узла
+  while (nodeptr != this->root && is_black(nodeptr)) {
+    if (nodeptr == parent->left) {
+      Node<Key, Value>* brother = parent->right;
+      if (brother->color == Red) {
+        brother->color = Black;
+        parent->color = Red;
+        left_rotate(parent);
+        brother = parent->right;
+      }
+      if (is_black(brother->left) && is_black(brother->right)) {
+        brother->color = Red;
+        nodeptr = parent;
+        parent = nodeptr->parent;
+      } else {
+        if (is_black(brother->right)) {
+          brother->left->color = Black;
+          brother->color = Red;
+          right_rotate(brother);
+          brother = parent->right;
+        }
+        brother->color = parent->color;
+        parent->color = Black;
+        brother->right->color = Black;
+        left_rotate(parent);
+        nodeptr = this->root;
+      }
+    } else {
+      Node<Key, Value>* brother = parent->left;
+      if (brother->color == Red) {
+        brother->color = Black;
+        parent->color = Red;
+        right_rotate(parent);
+        brother = parent->left;
+      }
+      if (is_black(brother->left) && is_black(brother->right)) {
+        brother->color = Red;
+        nodeptr = parent;
+        parent = nodeptr->parent;
+      } else {
+        if (is_black(brother->left)) {
+          brother->right->color = Black;
+          brother->color = Red;
+          left_rotate(brother);
+          brother = parent->left;
+        }
+        brother->color = parent->color;
+        parent->color = Black;
+        brother->left->color = Black;
+        right_rotate(parent);
+        nodeptr = this->root;
+      }
+    }
+  }
+  if (nodeptr != nullptr) {
+    nodeptr->color = Black;
+  }
+}
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::ReplaceNode(Node<Key, Value>* old_node,
+                                     Node<Key, Value>* new_node) {
+  if (old_node->parent == nullptr) {
+    this->root = new_node;
+  } else if (old_node->parent->left == old_node) {
+    old_node->parent->left = new_node;
+  } else {
+    old_node->parent->right = new_node;
+  }
+  if (new_node != nullptr) {
+    new_node->parent = old_node->parent;
+  }
+}
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::UpdateAugmentPath(Node<Key, Value>* node) {
+  if constexpr (RBtreeAugment<Key, Value>::enabled) {
+    for (; node != nullptr; node = node->parent) {
+      RBtreeAugment<Key, Value>::update(node);
     }
   }
 }
@@ -493,6 +800,8 @@ void RBtree<Key, Value>::right_rotate(Node<Key, Value>* x) {
   }
   left_child->right = x;
   x->parent = left_child;
+  RBtreeAugment<Key, Value>::update(x);
+  RBtreeAugment<Key, Value>::update(left_child);
 }
 
 template <typename Key, typename Value>
@@ -512,6 +821,8 @@ void RBtree<Key, Value>::left_rotate(Node<Key, Value>* x) {
   }
   right_child->left = x;
   x->parent = right_child;
+  RBtreeAugment<Key, Value>::update(x);
+  RBtreeAugment<Key, Value>::update(right_child);
 }
 
 /*
@@ -684,15 +995,26 @@ typename RBtree<Key, Value>::Iterator RBtree<Key, Value>::upper_bound(
 
 template <typename Key, typename Value>
 size_t RBtree<Key, Value>::size() {
-  return RecursiveSize(root);
+  return SubtreeSize(root);
 }
 
 template <typename Key, typename Value>
-size_t RBtree<Key, Value>::RecursiveSize(Node<Key, Value>* node) {
-  if (node == nullptr) return 0;
-  size_t left_size = RecursiveSize(node->left);
-  size_t right_size = RecursiveSize(node->right);
-  return 1 + left_size + right_size;
+size_t RBtree<Key, Value>::SubtreeSize(Node<Key, Value>* node) {
+  size_t count = 0;
+  Node<Key, Value>* buf = MinNode(node);
+  while (buf != nullptr) {
+    ++count;
+    if (buf->right != nullptr) {
+      buf = MinNode(buf->right);
+    } else {
+      // Поднимаемся, пока идем из правого поддерева, но не выше node
+      while (buf != node && buf->parent->right == buf) {
+        buf = buf->parent;
+      }
+      buf = (buf != node) ? buf->parent : nullptr;
+    }
+  }
+  return count;
 }
 
 template <typename Key, typename Value>
@@ -700,4 +1022,64 @@ bool RBtree<Key, Value>::empty() {
   return root == nullptr;
 }
 
+template <typename Key, typename Value>
+template <class Func>
+void RBtree<Key, Value>::ForEachNode(Func func) {
+  Node<Key, Value>* node = MinNode(root);
+  while (node != nullptr) {
+    func(node);
+    if (node->right != nullptr) {
+      node = MinNode(node->right);
+    } else {
+      Node<Key, Value>* buf_parent = node->parent;
+      while (buf_parent != nullptr && buf_parent->right == node) {
+        node = buf_parent;
+        buf_parent = node->parent;
+      }
+      node = buf_parent;
+    }
+  }
+}
+
+/*
+  СОХРАНЕНИЕ И ЗАГРУЗКА
+*/
+
+template <typename Key, typename Value>
+void RBtree<Key, Value>::BuildFromSorted(const Key* keys, const Value* values,
+                                         size_type count) {
+  clear();
+  // Дерево из count узлов занимает levels уровней, все уровни, кроме
+  // последнего, заполнены. Если последний заполнен не полностью, он красный
+  size_type levels = 0;
+  while ((size_type{1} << levels) - 1 < count) {
+    ++levels;
+  }
+  size_type red_depth = levels;
+  if ((size_type{1} << levels) - 1 != count) {
+    red_depth = levels - 1;
+  }
+  root = BuildSubtree(keys, values, 0, count, 0, red_depth, nullptr);
+}
+
+template <typename Key, typename Value>
+Node<Key, Value>* RBtree<Key, Value>::BuildSubtree(
+    const Key* keys, const Value* values, size_type lo, size_type hi,
+    size_type depth, size_type red_depth, Node<Key, Value>* parent) {
+  Node<Key, Value>* new_node = nullptr;
+  if (lo < hi) {
+    size_type mid = lo + (hi - lo) / 2;
+    new_node = new Node<Key, Value>;
+    new_node->key = keys[mid];
+    new_node->value = values[mid];
+    new_node->parent = parent;
+    new_node->color = (depth == red_depth) ? Red : Black;
+    new_node->left =
+        BuildSubtree(keys, values, lo, mid, depth + 1, red_depth, new_node);
+    new_node->right =
+        BuildSubtree(keys, values, mid + 1, hi, depth + 1, red_depth, new_node);
+  }
+  return new_node;
+}
+
 #endif
\ No newline at end of file
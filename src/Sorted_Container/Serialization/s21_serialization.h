@@ -0,0 +1,260 @@
+#ifndef S21_SERIALIZATION_H
+#define S21_SERIALIZATION_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/*
+  ФОРМАТ ФАЙЛА
+
+  [SortedFileHeader][count ключей][выравнивание][count значений]
+
+  Ключи записываются в порядке возрастания, значения - в том же порядке.
+  У set и multiset значений нет. Числа хранятся в порядке байтов машины.
+  Порядок ключей проверяется при открытии: двоичный поиск и построение
+  дерева верны только на отсортированном массиве
+*/
+
+template <typename Key, typename Value>
+class RBtree;
+
+// Флаги заголовка файла
+enum SortedFileFlags : uint32_t {
+  kSortedFileValues = 1,  // после ключей записаны значения
+  kSortedFileUnique = 2   // ключи не повторяются
+};
+
+struct SortedFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t key_size;
+  uint32_t value_size;
+  uint64_t count;
+  uint64_t values_offset;
+  char reserved[24];
+};
+
+static_assert(sizeof(SortedFileHeader) == 64,
+              "Header size is a part of the file format");
+
+constexpr char kSortedFileMagic[8] = {'S', '2', '1', 'S', 'O', 'R', 'T', 'D'};
+constexpr uint32_t kSortedFileVersion = 1;
+
+// Этот метод возвращает смещение массива значений в файле
+inline uint64_t SortedFileValuesOffset(uint64_t count, uint64_t key_size,
+                                       uint64_t value_align) {
+  uint64_t offset = sizeof(SortedFileHeader) + count * key_size;
+  return (offset + value_align - 1) / value_align * value_align;
+}
+
+// Файл, отображенный в память только для чтения
+class MappedFile {
+ public:
+  // Конструктор, который открывает файл и отображает его в память
+  explicit MappedFile(const std::string& path) : address(nullptr), length(0) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Cannot open file " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Cannot stat file " + path);
+    }
+    length = static_cast<size_t>(info.st_size);
+    if (length != 0) {
+      address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      address = nullptr;
+      throw std::runtime_error("Cannot map file " + path);
+    }
+  }
+
+  // Конструктор перемещения
+  MappedFile(MappedFile&& other) noexcept
+      : address(other.address), length(other.length) {
+    other.address = nullptr;
+    other.length = 0;
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Деструктор
+  ~MappedFile() {
+    if (address != nullptr) {
+      ::munmap(address, length);
+    }
+  }
+
+  // Этот метод возвращает начало отображения
+  const char* data() const { return static_cast<const char*>(address); }
+
+  // Этот метод возвращает размер файла
+  size_t size() const { return length; }
+
+ private:
+  void* address;
+  size_t length;
+};
+
+// Проверенный доступ к массивам ключей и значений отображенного файла
+template <typename Key, typename Value>
+class SortedFileView {
+ public:
+  static_assert(std::is_trivially_copyable<Key>::value &&
+                    std::is_trivially_copyable<Value>::value,
+                "Only trivially copyable keys and values can be mapped");
+
+  // Конструктор, который проверяет заголовок. required_flags - флаги,
+  // без которых файл не подходит контейнеру. Флаг kSortedFileValues задает
+  // вид контейнера и должен совпадать: файл map не читается как set и
+  // наоборот
+  SortedFileView(const std::string& path, uint32_t required_flags)
+      : file(path), header(nullptr) {
+    static_assert(alignof(Key) <= sizeof(SortedFileHeader),
+                  "Keys must be aligned by the header size");
+    if (file.size() < sizeof(SortedFileHeader)) {
+      throw std::runtime_error("File is too small: " + path);
+    }
+    header = reinterpret_cast<const SortedFileHeader*>(file.data());
+    if (std::memcmp(header->magic, kSortedFileMagic, sizeof(header->magic)) !=
+            0 ||
+        header->version != kSortedFileVersion ||
+        (header->flags & ~uint32_t{kSortedFileValues | kSortedFileUnique}) !=
+            0) {
+      throw std::runtime_error("Unknown file format: " + path);
+    }
+    if ((header->flags & required_flags) != required_flags ||
+        hasValues() != ((required_flags & kSortedFileValues) != 0) ||
+        header->key_size != sizeof(Key) ||
+        header->value_size != (hasValues() ? sizeof(Value) : 0)) {
+      throw std::runtime_error("File doesn't match container type: " + path);
+    }
+    // Размеры сравниваются делением, чтобы count * size не переполнялось
+    uint64_t body = file.size() - sizeof(SortedFileHeader);
+    if (header->count > body / sizeof(Key)) {
+      throw std::runtime_error("File is truncated: " + path);
+    }
+    if (hasValues()) {
+      // Значения лежат ровно там, куда их кладет SaveSortedFile: сразу после
+      // ключей с выравниванием под Value
+      uint64_t offset =
+          SortedFileValuesOffset(header->count, sizeof(Key), alignof(Value));
+      if (header->values_offset != offset) {
+        throw std::runtime_error("Bad values offset: " + path);
+      }
+      if (header->values_offset > file.size() ||
+          header->count >
+              (file.size() - header->values_offset) / sizeof(Value)) {
+        throw std::runtime_error("File is truncated: " + path);
+      }
+    }
+    // Ключи читаются один раз целиком, значения не трогаются
+    const Key* sorted = keys();
+    bool unique = (header->flags & kSortedFileUnique) != 0;
+    for (uint64_t i = 1; i < header->count; ++i) {
+      if (unique ? !(sorted[i - 1] < sorted[i]) : sorted[i] < sorted[i - 1]) {
+        throw std::invalid_argument("Keys are out of order: " + path);
+      }
+    }
+  }
+
+  // Этот метод возвращает количество записей
+  size_t count() const { return static_cast<size_t>(header->count); }
+
+  // Этот метод возвращает флаги файла
+  uint32_t flags() const { return header->flags; }
+
+  // Этот метод проверяет, записаны ли в файле значения
+  bool hasValues() const { return (header->flags & kSortedFileValues) != 0; }
+
+  // Этот метод возвращает отсортированный массив ключей
+  const Key* keys() const {
+    return reinterpret_cast<const Key*>(file.data() +
+                                        sizeof(SortedFileHeader));
+  }
+
+  // Этот метод возвращает массив значений. Если значений в файле нет, то
+  // значениями считаются сами ключи, как в set
+  const Value* values() const {
+    if (hasValues()) {
+      return reinterpret_cast<const Value*>(file.data() +
+                                            header->values_offset);
+    }
+    if constexpr (std::is_same<Key, Value>::value) {
+      return keys();
+    } else {
+      throw std::runtime_error("File has no values");
+    }
+  }
+
+ private:
+  MappedFile file;
+  const SortedFileHeader* header;
+};
+
+// Этот метод записывает ключи дерева, а при флаге kSortedFileValues и
+// значения, в файл в порядке обхода
+template <typename Key, typename Value>
+void SaveSortedFile(RBtree<Key, Value>& tree, const std::string& path,
+                    uint32_t flags) {
+  static_assert(std::is_trivially_copyable<Key>::value &&
+                    std::is_trivially_copyable<Value>::value,
+                "Only trivially copyable keys and values can be saved");
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    throw std::runtime_error("Cannot open file " + path);
+  }
+  SortedFileHeader header = {};
+  std::memcpy(header.magic, kSortedFileMagic, sizeof(header.magic));
+  header.version = kSortedFileVersion;
+  header.flags = flags;
+  header.key_size = sizeof(Key);
+  header.value_size = (flags & kSortedFileValues) ? sizeof(Value) : 0;
+  // Заголовок дописывается в конце, когда известно количество ключей
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  tree.ForEachNode([&out, &header](auto* node) {
+    out.write(reinterpret_cast<const char*>(&node->key), sizeof(Key));
+    ++header.count;
+  });
+  if (flags & kSortedFileValues) {
+    header.values_offset =
+        SortedFileValuesOffset(header.count, sizeof(Key), alignof(Value));
+    uint64_t written = sizeof(header) + header.count * sizeof(Key);
+    for (; written < header.values_offset; ++written) {
+      out.put('\0');
+    }
+    tree.ForEachNode([&out](auto* node) {
+      out.write(reinterpret_cast<const char*>(&node->value), sizeof(Value));
+    });
+  }
+  out.seekp(0);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (!out) {
+    throw std::runtime_error("Cannot write file " + path);
+  }
+}
+
+// Этот метод заменяет содержимое дерева данными из файла. Файл
+// отображается в память, дерево строится через BuildFromSorted
+template <typename Key, typename Value>
+void LoadSortedFile(RBtree<Key, Value>& tree, const std::string& path,
+                    uint32_t required_flags) {
+  SortedFileView<Key, Value> view(path, required_flags);
+  tree.BuildFromSorted(view.keys(), view.values(), view.count());
+}
+
+#endif  // S21_SERIALIZATION_H
@@ -3,8 +3,11 @@
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
+#include "../../Serialization/s21_serialization.h"
+
 namespace s21 {
 
 template <typename Key>
@@ -40,6 +43,8 @@ class multiset : public RBtree<Key, Key> {
   iterator find(const Key& key);
   void erase(iterator pos);
   std::pair<iterator, iterator> equal_range(const Key& key);
+  void save(const std::string& path);
+  void load(const std::string& path);
   class ConstMultisetIterator : public RBtree<Key, Key>::Iterator {
    public:
     friend class multiset;
@@ -204,5 +209,15 @@ typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
   return res;
 }
 
+template <typename Key>
+void multiset<Key>::save(const std::string& path) {
+  SaveSortedFile(*this, path, 0);
+}
+
+template <typename Key>
+void multiset<Key>::load(const std::string& path) {
+  LoadSortedFile(*this, path, 0);
+}
+
 }  // namespace s21
 #endif  // end of S21_CONTAINER_MULTISET_H
@@ -3,8 +3,12 @@
 #ifndef CPP2_S21_CONTAINERS_S21_CONTAINERS_SET_SET_H_
 #define CPP2_S21_CONTAINERS_S21_CONTAINERS_SET_SET_H_
 
+#include <string>
 #include <vector>
 
+#include "../../Frozen_Container/frozen_set_dir/s21_frozen_set.h"
+#include "../../Serialization/s21_serialization.h"
+
 namespace s21 {
 
 template <typename Key>
@@ -35,6 +39,30 @@ class set : public RBtree<Key, Key> {
   iterator find(const Key& key) {
     return RBtree<Key, Key>::findNodeByKey(key);
   };
+
+  // Этот метод ищет сразу несколько ключей и записывает в out итераторы в
+  // порядке ключей. Для отсутствующего ключа итератор равен nullptr
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                      OutputIt out);
+
+  // Этот метод для каждого ключа записывает в out, есть ли он в контейнере
+  template <class ForwardIt, class OutputIt>
+  OutputIt contains_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                          OutputIt out);
+
+  // Этот метод создает неизменяемую копию множества для быстрого поиска
+  frozen_set<Key> freeze();
+
+  // Этот метод сохраняет множество в бинарный файл
+  void save(const std::string& path) {
+    SaveSortedFile(*this, path, kSortedFileUnique);
+  }
+
+  // Этот метод заменяет содержимое множества данными из файла
+  void load(const std::string& path) {
+    LoadSortedFile(*this, path, kSortedFileUnique);
+  }
 };
 
 template <typename Key>
@@ -100,6 +128,35 @@ bool set<Key>::contains(const Key& key) {
   return otv;
 }
 
+template <typename Key>
+template <class ForwardIt, class OutputIt>
+OutputIt set<Key>::find_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                              OutputIt out) {
+  iterator cursor(this->root);
+  for (Node<Key, Key>* node : this->findNodesBatch(keys_begin, keys_end)) {
+    *out++ = cursor(node);
+  }
+  return out;
+}
+
+template <typename Key>
+template <class ForwardIt, class OutputIt>
+OutputIt set<Key>::contains_batch(ForwardIt keys_begin, ForwardIt keys_end,
+                                  OutputIt out) {
+  for (Node<Key, Key>* node : this->findNodesBatch(keys_begin, keys_end)) {
+    *out++ = node != nullptr;
+  }
+  return out;
+}
+
+template <typename Key>
+frozen_set<Key> set<Key>::freeze() {
+  std::vector<Key> keys;
+  this->ForEachNode(
+      [&keys](Node<Key, Key>* node) { keys.push_back(node->key); });
+  return frozen_set<Key>(keys);
+}
+
 template <typename Key>
 set<Key>::set(const std::initializer_list<value_type>& items) {
   for (auto& element : items) {
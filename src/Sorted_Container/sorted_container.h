@@ -1,6 +1,8 @@
 #ifndef S21_CONTAINERS_SRC_SORTED_CONTAINERS_H_
 #define S21_CONTAINERS_SRC_SORTED_CONTAINERS_H_
 #include "Associative_Container/associatice_container.h"
+#include "Frozen_Container/frozen_container.h"
+#include "Mapped_Container/mapped_container.h"
 #include "RBtree/s21_RBtree.h"
 #include "Set_Container/set_container.h"
 #endif
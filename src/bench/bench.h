@@ -0,0 +1,46 @@
+#ifndef S21_BENCH_H
+#define S21_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace bench {
+// Запись в volatile нельзя выбросить, а с ней и вычисление значения
+template <class T>
+inline volatile T sink;
+
+// Этот метод сохраняет значение так, чтобы компилятор не выбросил его
+// вычисление
+template <class T>
+void Keep(const T& value) {
+  sink<T> = value;
+}
+
+// Этот метод запускает body repeats раз и возвращает время самого быстрого
+// запуска в наносекундах. Минимум меньше всего зависит от прерываний и
+// соседних процессов
+template <class Body>
+double BestOf(int repeats, Body&& body) {
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < repeats; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    Keep(body());
+    auto stop = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  return best;
+}
+
+// Этот метод возвращает время работы body в наносекундах
+template <class Body>
+double Elapsed(Body&& body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+}  // namespace bench
+
+#endif  // S21_BENCH_H
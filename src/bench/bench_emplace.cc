@@ -0,0 +1,54 @@
+// Вставка в s21::vector свежесобранных строк: push_back(const T&) копирует
+// строку, push_back(T&&) забирает ее буфер, emplace_back строит строку
+// сразу на месте. Строки длиннее буфера малой строки, поэтому копия стоит
+// выделения памяти. Первый аргумент задает количество строк вместо 10
+// миллионов. Числа - миллионы строк в секунду
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultCount = 10'000'000;
+constexpr size_t kLength = 48;
+constexpr int kRepeats = 3;
+
+char Letter(size_t i) { return static_cast<char>('a' + i % 26); }
+
+template <class Push>
+double Run(size_t count, Push push) {
+  double ns = bench::BestOf(kRepeats, [&] {
+    s21::vector<std::string> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) push(values, i);
+    return values.size();
+  });
+  return count / ns * 1e3;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t count =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultCount;
+  std::printf("s21::vector<std::string>, %zu strings of %zu chars\n", count,
+              kLength);
+  std::printf("%-16s %10s\n", "insert", "Mstr/s");
+  std::printf("%-16s %10.1f\n", "push_back(copy)",
+              Run(count, [](s21::vector<std::string>& values, size_t i) {
+                std::string text(kLength, Letter(i));
+                values.push_back(text);
+              }));
+  std::printf("%-16s %10.1f\n", "push_back(move)",
+              Run(count, [](s21::vector<std::string>& values, size_t i) {
+                std::string text(kLength, Letter(i));
+                values.push_back(std::move(text));
+              }));
+  std::printf("%-16s %10.1f\n", "emplace_back",
+              Run(count, [](s21::vector<std::string>& values, size_t i) {
+                values.emplace_back(kLength, Letter(i));
+              }));
+  return 0;
+}
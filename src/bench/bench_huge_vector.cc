@@ -0,0 +1,41 @@
+// Рост s21::vector<uint64_t> через push_back до kDefaultMiB мегабайт (16
+// ГиБ) с std::allocator и с huge_page_allocator. Первый вектор при каждом
+// удвоении копирует весь буфер, второй растет через mremap без копирования.
+// На обычной машине 16 ГиБ не поместятся с копией, поэтому первый аргумент
+// задает другой размер в мегабайтах. Печатается время роста и скорость
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../Sequence_Container/vector_dir/huge_page_allocator.h"
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultMiB = 16 * 1024;
+
+template <class Vector>
+void Grow(const char* name, size_t elements) {
+  size_t capacity = 0;
+  double ns = bench::Elapsed([&] {
+    Vector values;
+    for (size_t i = 0; i < elements; ++i) values.push_back(i);
+    capacity = values.capacity();
+  });
+  bench::Keep(capacity);
+  double bytes = static_cast<double>(elements * sizeof(uint64_t));
+  std::printf("%-22s %10.1f %10.2f\n", name, ns / 1e6, bytes / ns);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultMiB;
+  size_t elements = (mib << 20) / sizeof(uint64_t);
+  std::printf("s21::vector<uint64_t> growth to %zu MiB, %zu elements\n", mib,
+              elements);
+  std::printf("%-22s %10s %10s\n", "allocator", "ms", "GB/s");
+  Grow<s21::vector<uint64_t>>("std::allocator", elements);
+  Grow<s21::vector<uint64_t, s21::huge_page_allocator<uint64_t>>>(
+      "huge_page_allocator", elements);
+  return 0;
+}
@@ -0,0 +1,54 @@
+// Копирование s21::map: обычный конструктор копирования против CopyFrom,
+// который раздает верхние поддеревья отдельным потокам. Размер карты
+// по умолчанию 50 миллионов записей, первый аргумент задает другой.
+// Выводится время одной копии и ускорение относительно конструктора
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultEntries = 50'000'000;
+
+using map = s21::map<int, int>;
+
+// Освобождение копии не входит в замер: дерево разрушается вне Elapsed
+double SerialCopy(const map& source) {
+  std::unique_ptr<map> copy;
+  double ns = bench::Elapsed([&] { copy = std::make_unique<map>(source); });
+  bench::Keep(copy->size());
+  return ns;
+}
+
+double ParallelCopy(const map& source, unsigned threads) {
+  map copy;
+  double ns = bench::Elapsed([&] { copy.CopyFrom(source, threads); });
+  bench::Keep(copy.size());
+  return ns;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t entries = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                            : kDefaultEntries;
+  unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+  map source;
+  for (size_t i = 0; i < entries; ++i)
+    source.insert(static_cast<int>(i), static_cast<int>(i * 7));
+  std::printf("s21::map<int, int> copy, %zu entries, %u hardware threads\n",
+              entries, cores);
+  std::printf("%-22s %10s %8s\n", "copy", "ms", "speedup");
+  double serial = SerialCopy(source);
+  std::printf("%-22s %10.1f %8.2f\n", "copy constructor", serial / 1e6, 1.0);
+  for (unsigned threads = 1; threads <= cores * 2; threads *= 2) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "CopyFrom, %u threads", threads);
+    double ns = ParallelCopy(source, threads);
+    std::printf("%-22s %10.1f %8.2f\n", name, ns / 1e6, serial / ns);
+  }
+  return 0;
+}
@@ -0,0 +1,116 @@
+// Масштабирование s21::parallel::sort, transform и reduce по числу потоков
+// пула: 1, 2, 4 ... 32. Размер пула задается переменной S21_THREADS при
+// первом обращении к default_pool(), поэтому каждый размер меряется в
+// отдельном дочернем процессе. Строка std - однопоточные std::sort,
+// std::transform и std::accumulate. Первый аргумент задает длину массива
+// вместо 100 миллионов. Числа - миллисекунды лучшего прогона
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <string>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultElements = 100'000'000;
+constexpr unsigned kMaxThreads = 32;
+constexpr int kRepeats = 3;
+
+void Fill(s21::vector<uint32_t>& values, size_t elements) {
+  uint32_t state = 12345;
+  for (size_t i = 0; i < elements; ++i) {
+    state = state * 1103515245u + 12345u;
+    values.push_back(state);
+  }
+}
+
+// Сортируется копия исходного массива, копирование не входит в замер
+template <class Sort>
+double SortTime(const s21::vector<uint32_t>& source, Sort sort) {
+  double best = 0;
+  for (int i = 0; i < kRepeats; ++i) {
+    s21::vector<uint32_t> values(source);
+    double ns = bench::Elapsed([&] { sort(values); });
+    bench::Keep(values[values.size() / 2]);
+    best = i == 0 ? ns : std::min(best, ns);
+  }
+  return best;
+}
+
+uint32_t Mix(uint32_t x) { return (x ^ (x >> 15)) * 2246822519u; }
+
+void PrintRow(const char* name, double sort_ns, double transform_ns,
+              double reduce_ns) {
+  std::printf("%-8s %10.1f %10.1f %10.1f\n", name, sort_ns / 1e6,
+              transform_ns / 1e6, reduce_ns / 1e6);
+  std::fflush(stdout);
+}
+
+void RunStd(const s21::vector<uint32_t>& source, s21::vector<uint32_t>& out) {
+  const uint32_t* first = source.data();
+  const uint32_t* last = first + source.size();
+  PrintRow(
+      "std",
+      SortTime(source,
+               [](s21::vector<uint32_t>& v) { std::sort(v.begin(), v.end()); }),
+      bench::BestOf(kRepeats,
+                    [&] {
+                      std::transform(first, last, out.begin(), Mix);
+                      return out[0];
+                    }),
+      bench::BestOf(kRepeats, [&] {
+        return std::accumulate(first, last, uint64_t{0});
+      }));
+}
+
+void RunParallel(const s21::vector<uint32_t>& source,
+                 s21::vector<uint32_t>& out) {
+  const uint32_t* first = source.data();
+  const uint32_t* last = first + source.size();
+  std::string name = std::to_string(s21::parallel::default_pool().size());
+  PrintRow(name.c_str(),
+           SortTime(source,
+                    [](s21::vector<uint32_t>& v) { s21::parallel::sort(v); }),
+           bench::BestOf(kRepeats,
+                         [&] {
+                           s21::parallel::transform(first, last, out.begin(),
+                                                    Mix);
+                           return out[0];
+                         }),
+           bench::BestOf(kRepeats, [&] {
+             return s21::parallel::reduce(first, last, uint64_t{0},
+                                          std::plus<>());
+           }));
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t elements =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultElements;
+  s21::vector<uint32_t> source;
+  Fill(source, elements);
+  s21::vector<uint32_t> out(elements);
+  std::printf("s21::parallel, %zu uint32_t, %ld cores, ms\n", elements,
+              sysconf(_SC_NPROCESSORS_ONLN));
+  std::printf("%-8s %10s %10s %10s\n", "threads", "sort", "transform",
+              "reduce");
+  RunStd(source, out);
+  // Родитель не трогает default_pool(), поэтому к fork он однопоточный
+  for (unsigned threads = 1; threads <= kMaxThreads; threads *= 2) {
+    pid_t child = fork();
+    if (child == 0) {
+      setenv("S21_THREADS", std::to_string(threads).c_str(), 1);
+      RunParallel(source, out);
+      std::_Exit(0);
+    }
+    if (child > 0) waitpid(child, nullptr, 0);
+  }
+  return 0;
+}
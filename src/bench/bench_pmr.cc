@@ -0,0 +1,74 @@
+// Рабочая нагрузка "на запрос": каждый запрос собирает несколько небольших
+// векторов через push_back и сразу их выбрасывает. s21::vector с
+// std::allocator сравнивается с s21::pmr::vector на арене запроса -
+// std::pmr::monotonic_buffer_resource поверх буфера на стеке - и на
+// new_delete_resource, который показывает цену самого polymorphic_allocator.
+// Первый аргумент задает количество запросов вместо миллиона. Числа - тысячи
+// запросов в секунду
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultRequests = 1'000'000;
+constexpr size_t kVectors = 8;
+constexpr size_t kElements = 48;
+// Хватает на все векторы запроса вместе с брошенными при росте буферами
+constexpr size_t kArenaBytes = 16 * 1024;
+constexpr int kRepeats = 3;
+
+// Запрос собирает kVectors векторов разной длины и возвращает сумму
+template <class Vector, class... Alloc>
+long Request(size_t request, const Alloc&... alloc) {
+  long sum = 0;
+  for (size_t v = 0; v < kVectors; ++v) {
+    Vector values(alloc...);
+    size_t length = kElements / 2 + (request + v) % kElements;
+    for (size_t i = 0; i < length; ++i)
+      values.push_back(static_cast<int>(request + i));
+    for (int value : values) sum += value;
+  }
+  return sum;
+}
+
+template <class Body>
+double Run(size_t requests, Body body) {
+  double ns = bench::BestOf(kRepeats, [&] {
+    long sum = 0;
+    for (size_t r = 0; r < requests; ++r) sum += body(r);
+    return sum;
+  });
+  return requests / ns * 1e6;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t requests =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultRequests;
+  std::printf("%zu requests, %zu vectors of up to %zu ints each\n", requests,
+              kVectors, kElements * 3 / 2);
+  std::printf("%-30s %12s\n", "storage", "Kreq/s");
+  std::printf("%-30s %12.1f\n", "s21::vector, std::allocator",
+              Run(requests, [](size_t r) {
+                return Request<s21::vector<int>>(r);
+              }));
+  std::printf("%-30s %12.1f\n", "pmr::vector, new_delete",
+              Run(requests, [](size_t r) {
+                std::pmr::polymorphic_allocator<int> alloc(
+                    std::pmr::new_delete_resource());
+                return Request<s21::pmr::vector<int>>(r, alloc);
+              }));
+  std::printf("%-30s %12.1f\n", "pmr::vector, monotonic arena",
+              Run(requests, [](size_t r) {
+                alignas(std::max_align_t) std::byte buffer[kArenaBytes];
+                std::pmr::monotonic_buffer_resource arena(
+                    buffer, sizeof(buffer), std::pmr::null_memory_resource());
+                std::pmr::polymorphic_allocator<int> alloc(&arena);
+                return Request<s21::pmr::vector<int>>(r, alloc);
+              }));
+  return 0;
+}
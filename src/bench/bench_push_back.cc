@@ -0,0 +1,46 @@
+// Рост s21::vector через push_back в сравнении с std::vector: kDefaultCount
+// чисел int и столько же коротких std::string, которые при переезде в
+// новый буфер перемещаются, а не копируются. Первый аргумент задает
+// другое количество элементов. Числа - миллионы элементов в секунду
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultCount = 100'000'000;
+constexpr int kRepeats = 3;
+
+template <class Vector, class Make>
+double PushBack(size_t count, Make make) {
+  return bench::BestOf(kRepeats, [&] {
+    Vector values;
+    for (size_t i = 0; i < count; ++i) values.push_back(make(i));
+    return values.size();
+  });
+}
+
+template <class T, class Make>
+void PrintRow(const char* type, size_t count, Make make) {
+  double s21_ns = PushBack<s21::vector<T>>(count, make);
+  double std_ns = PushBack<std::vector<T>>(count, make);
+  std::printf("%-12s %12.1f %12.1f\n", type, count / s21_ns * 1e3,
+              count / std_ns * 1e3);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t count =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultCount;
+  // Строка короче буфера малой строки, поэтому замер не упирается в malloc
+  const std::string text = "element";
+  std::printf("push_back, %zu elements, Melems/s\n", count);
+  std::printf("%-12s %12s %12s\n", "type", "s21::vector", "std::vector");
+  PrintRow<int>("int", count, [](size_t i) { return static_cast<int>(i); });
+  PrintRow<std::string>("std::string", count,
+                        [&text](size_t) -> const std::string& { return text; });
+  return 0;
+}
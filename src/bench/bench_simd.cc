@@ -0,0 +1,104 @@
+// Сравнение ядер s21::simd с обычным циклом (уровень scalar) и алгоритмами
+// std:: на массивах int32_t и float, а также подсчета битов в bit_vector.
+// Числа - гигабайты в секунду по лучшему из нескольких прогонов
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+// 256 КиБ int32_t: массив помещается в L2, и меряются сами ядра, а не
+// пропускная способность памяти
+constexpr size_t kElements = size_t{1} << 16;
+constexpr int kRepeats = 300;
+
+const char* LevelName(s21::simd::isa level) {
+  switch (level) {
+    case s21::simd::isa::scalar:
+      return "scalar";
+    case s21::simd::isa::sse2:
+      return "sse2";
+    case s21::simd::isa::avx2:
+      return "avx2";
+    case s21::simd::isa::avx512:
+      return "avx512";
+  }
+  return "?";
+}
+
+template <class T>
+void PrintRow(const char* type, const char* level, double find_ns,
+              double count_ns, double min_ns, double sum_ns) {
+  double bytes = static_cast<double>(kElements * sizeof(T));
+  std::printf("%-8s %-8s %8.2f %8.2f %8.2f %8.2f\n", type, level,
+              bytes / find_ns, bytes / count_ns, bytes / min_ns,
+              bytes / sum_ns);
+}
+
+template <class T>
+void RunKernels(const char* type, const s21::vector<T>& values) {
+  const T* first = values.data();
+  const T* last = first + values.size();
+  // Искомого значения нет, поэтому find проходит весь массив
+  const T absent = T(-1);
+  PrintRow<T>(
+      type, "std",
+      bench::BestOf(kRepeats,
+                    [&] { return std::find(first, last, absent) - first; }),
+      bench::BestOf(kRepeats, [&] { return std::count(first, last, T(7)); }),
+      bench::BestOf(kRepeats, [&] { return *std::min_element(first, last); }),
+      bench::BestOf(kRepeats,
+                    [&] { return std::accumulate(first, last, T(0)); }));
+  for (s21::simd::isa level :
+       {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2,
+        s21::simd::isa::avx512}) {
+    if (level > s21::simd::detected_isa()) continue;
+    s21::simd::limit_isa(level);
+    PrintRow<T>(
+        type, LevelName(level),
+        bench::BestOf(kRepeats,
+                      [&] { return s21::simd::find(values, absent) - first; }),
+        bench::BestOf(kRepeats, [&] { return s21::simd::count(values, T(7)); }),
+        bench::BestOf(kRepeats, [&] { return s21::simd::min(values); }),
+        bench::BestOf(kRepeats, [&] { return s21::simd::sum(values); }));
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
+
+void RunBitCount() {
+  s21::vector<uint64_t> words;
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  for (size_t i = 0; i < kElements; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    words.push_back(state);
+  }
+  double bytes = static_cast<double>(kElements * sizeof(uint64_t));
+  double portable = bench::BestOf(kRepeats, [&] {
+    return s21::__bit_count_portable(words.data(), words.size());
+  });
+  double dispatched = bench::BestOf(
+      kRepeats, [&] { return s21::__bit_count(words.data(), words.size()); });
+  std::printf("\nbit_vector::count, GB/s\n");
+  std::printf("%-10s %8.2f\n%-10s %8.2f\n", "portable", bytes / portable,
+              "dispatch", bytes / dispatched);
+}
+}  // namespace
+
+int main() {
+  s21::vector<int32_t> ints;
+  s21::vector<float> floats;
+  for (size_t i = 0; i < kElements; ++i) {
+    ints.push_back(static_cast<int32_t>(i * 2654435761u % 1000));
+    floats.push_back(static_cast<float>(i % 1000));
+  }
+  std::printf("s21::simd, %zu elements, GB/s\n", kElements);
+  std::printf("%-8s %-8s %8s %8s %8s %8s\n", "type", "level", "find", "count",
+              "min", "sum");
+  RunKernels("int32_t", ints);
+  RunKernels("float", floats);
+  RunBitCount();
+  return 0;
+}
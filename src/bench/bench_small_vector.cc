@@ -0,0 +1,43 @@
+// Короткоживущие маленькие векторы: s21::small_vector<int, 8> против
+// s21::vector<int>. Каждый шаг создает вектор, заполняет его push_back,
+// суммирует и разрушает. До 8 элементов small_vector не обращается к куче,
+// при 16 переходит на нее. Первый аргумент задает количество векторов
+// вместо 10 миллионов. Числа - миллионы векторов в секунду
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultVectors = 10'000'000;
+constexpr size_t kInline = 8;
+constexpr int kRepeats = 3;
+
+template <class Vector>
+double Run(size_t vectors, size_t length) {
+  double ns = bench::BestOf(kRepeats, [&] {
+    long sum = 0;
+    for (size_t v = 0; v < vectors; ++v) {
+      Vector values;
+      for (size_t i = 0; i < length; ++i)
+        values.push_back(static_cast<int>(v + i));
+      for (int value : values) sum += value;
+    }
+    return sum;
+  });
+  return vectors / ns * 1e3;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t vectors =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultVectors;
+  std::printf("%zu short-lived vectors, Mvec/s\n", vectors);
+  std::printf("%-8s %14s %14s\n", "length", "small_vector", "vector");
+  for (size_t length : {size_t{1}, size_t{4}, kInline, kInline * 2})
+    std::printf("%-8zu %14.1f %14.1f\n", length,
+                Run<s21::small_vector<int, kInline>>(vectors, length),
+                Run<s21::vector<int>>(vectors, length));
+  return 0;
+}
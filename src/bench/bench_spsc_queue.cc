@@ -0,0 +1,136 @@
+// Сравнение s21::spsc_queue с s21::queue под std::mutex. Пропускная
+// способность - один поток передает другому kItems чисел по одному и
+// пачками. Задержка - два потока перебрасывают одно число через пару
+// очередей, выводится среднее время полного круга
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kItems = size_t{1} << 22;
+constexpr size_t kPings = size_t{1} << 17;
+constexpr size_t kBatch = 64;
+constexpr int kSpins = 1000;
+
+using spsc = s21::spsc_queue<size_t, 1024>;
+
+// Очередь из библиотеки под одним мьютексом с тем же интерфейсом и той же
+// емкостью, что у spsc_queue
+class locked_queue {
+ public:
+  bool try_push(size_t value) {
+    std::lock_guard<std::mutex> lock(__mutex);
+    bool pushed = __queue.size() < spsc::capacity();
+    if (pushed) __queue.push(value);
+    return pushed;
+  }
+  bool try_pop(size_t& out) {
+    std::lock_guard<std::mutex> lock(__mutex);
+    bool popped = !__queue.empty();
+    if (popped) {
+      out = __queue.front();
+      __queue.pop();
+    }
+    return popped;
+  }
+
+ private:
+  std::mutex __mutex;
+  s21::queue<size_t> __queue;
+};
+
+template <class Queue>
+double Throughput() {
+  Queue queue;
+  size_t sum = 0;
+  double ns = bench::Elapsed([&] {
+    std::thread producer([&queue] {
+      for (size_t i = 0; i < kItems; ++i)
+        while (!queue.try_push(i)) std::this_thread::yield();
+    });
+    size_t value = 0;
+    for (size_t i = 0; i < kItems; ++i) {
+      while (!queue.try_pop(value)) std::this_thread::yield();
+      sum += value;
+    }
+    producer.join();
+  });
+  bench::Keep(sum);
+  return kItems / ns * 1e3;
+}
+
+double BatchedThroughput() {
+  spsc queue;
+  size_t sum = 0;
+  double ns = bench::Elapsed([&] {
+    std::thread producer([&queue] {
+      size_t batch[kBatch];
+      for (size_t next = 0; next < kItems;) {
+        size_t n = std::min(kBatch, kItems - next);
+        for (size_t i = 0; i < n; ++i) batch[i] = next + i;
+        size_t pushed = queue.push_n(batch, n);
+        next += pushed;
+        if (pushed == 0) std::this_thread::yield();
+      }
+    });
+    size_t batch[kBatch];
+    for (size_t received = 0; received < kItems;) {
+      size_t popped = queue.pop_n(batch, kBatch);
+      for (size_t i = 0; i < popped; ++i) sum += batch[i];
+      received += popped;
+      if (popped == 0) std::this_thread::yield();
+    }
+    producer.join();
+  });
+  bench::Keep(sum);
+  return kItems / ns * 1e3;
+}
+
+// Ожидание сначала крутится, чтобы на время круга уходила сама передача,
+// а не планировщик. Если второй поток так и не ответил, например потому,
+// что ядро одно, процессор уступается ему
+template <class Try>
+void SpinUntil(Try&& attempt) {
+  for (int spins = 0; !attempt(); ++spins)
+    if (spins >= kSpins) std::this_thread::yield();
+}
+
+template <class Queue>
+double RoundTrip() {
+  Queue ping;
+  Queue pong;
+  double ns = bench::Elapsed([&] {
+    std::thread echo([&ping, &pong] {
+      size_t value = 0;
+      for (size_t i = 0; i < kPings; ++i) {
+        SpinUntil([&] { return ping.try_pop(value); });
+        SpinUntil([&] { return pong.try_push(value); });
+      }
+    });
+    size_t value = 0;
+    for (size_t i = 0; i < kPings; ++i) {
+      SpinUntil([&] { return ping.try_push(i); });
+      SpinUntil([&] { return pong.try_pop(value); });
+    }
+    echo.join();
+  });
+  return ns / kPings;
+}
+}  // namespace
+
+int main() {
+  std::printf("%zu items, %u hardware threads\n", kItems,
+              std::thread::hardware_concurrency());
+  std::printf("%-22s %12s %14s\n", "queue", "Mitems/s", "round trip ns");
+  std::printf("%-22s %12.1f %14.0f\n", "spsc_queue", Throughput<spsc>(),
+              RoundTrip<spsc>());
+  std::printf("%-22s %12.1f %14s\n", "spsc_queue push_n/pop_n",
+              BatchedThroughput(), "-");
+  std::printf("%-22s %12.1f %14.0f\n", "queue + mutex",
+              Throughput<locked_queue>(), RoundTrip<locked_queue>());
+  return 0;
+}
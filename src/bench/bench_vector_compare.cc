@@ -0,0 +1,60 @@
+// Сравнение двух равных s21::vector: operator== и operator< ищут первое
+// различие векторным сравнением памяти, цикл по элементам показывает
+// прежний поэлементный путь, std::equal и std::lexicographical_compare -
+// стандартную библиотеку. Векторы равны, поэтому все способы проходят их
+// до конца. Первый аргумент задает длину вместо 10 миллионов. Числа -
+// гигабайты в секунду по лучшему из нескольких прогонов
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_containers.h"
+#include "bench.h"
+
+namespace {
+constexpr size_t kDefaultElements = 10'000'000;
+constexpr int kRepeats = 10;
+
+template <class T>
+size_t ElementLoop(const s21::vector<T>& lhs, const s21::vector<T>& rhs) {
+  size_t common = std::min(lhs.size(), rhs.size());
+  size_t i = 0;
+  while (i < common && lhs[i] == rhs[i]) ++i;
+  return i;
+}
+
+template <class T>
+void RunType(const char* type, size_t elements) {
+  s21::vector<T> lhs;
+  for (size_t i = 0; i < elements; ++i)
+    lhs.push_back(static_cast<T>(i * 2654435761u));
+  s21::vector<T> rhs(lhs);
+  double bytes = static_cast<double>(elements * sizeof(T) * 2);
+  double equal = bench::BestOf(kRepeats, [&] { return lhs == rhs; });
+  double less = bench::BestOf(kRepeats, [&] { return lhs < rhs; });
+  double loop =
+      bench::BestOf(kRepeats, [&] { return ElementLoop(lhs, rhs); });
+  double std_equal = bench::BestOf(kRepeats, [&] {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  });
+  double std_less = bench::BestOf(kRepeats, [&] {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                        rhs.end());
+  });
+  std::printf("%-10s %10.2f %10.2f %10.2f %10.2f %10.2f\n", type,
+              bytes / equal, bytes / less, bytes / loop, bytes / std_equal,
+              bytes / std_less);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t elements =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultElements;
+  std::printf("s21::vector comparison, %zu elements, GB/s\n", elements);
+  std::printf("%-10s %10s %10s %10s %10s %10s\n", "type", "==", "<", "loop",
+              "std::equal", "std::lex");
+  RunType<int32_t>("int32_t", elements);
+  RunType<uint64_t>("uint64_t", elements);
+  return 0;
+}
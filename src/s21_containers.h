@@ -4,4 +4,5 @@
 #include "Additional_Container/additional_container.h"
 #include "Adaptor_Container/adaptor_container.h"
 #include "Sorted_Container/sorted_container.h"
+#include "Algorithm/algorithm.h"
 #endif // END S21_CONTAINERS_H
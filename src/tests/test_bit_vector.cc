@@ -0,0 +1,111 @@
+#include "test_headers.h"
+
+TEST(BitVector, matches_vector_bool) {
+  s21::bit_vector bits;
+  std::vector<bool> result;
+  for (int i = 0; i < 300; ++i) {
+    bool value = (i * 7) % 5 < 2;
+    bits.push_back(value);
+    result.push_back(value);
+  }
+  bits[3] = true;
+  result[3] = true;
+  bits[4] = bits[3];
+  result[4] = result[3];
+  bits.flip(250);
+  result[250] = !result[250];
+  bits.pop_back();
+  result.pop_back();
+  ASSERT_EQ(bits.size(), result.size());
+  size_t ones = 0;
+  for (size_t i = 0; i < result.size(); ++i) {
+    ASSERT_EQ(bits[i], result[i]);
+    ones += result[i];
+  }
+  ASSERT_EQ(bits.count(), ones);
+  ASSERT_EQ(bits.capacity() % 64, 0u);
+  ASSERT_THROW(bits.at(299), std::out_of_range);
+}
+
+TEST(BitVector, find_first_next) {
+  s21::bit_vector bits(1000);
+  ASSERT_EQ(bits.find_first(), s21::bit_vector::npos);
+  ASSERT_TRUE(bits.none());
+  std::vector<size_t> positions = {0, 63, 64, 130, 511, 999};
+  for (size_t pos : positions) bits.set(pos);
+  std::vector<size_t> found;
+  for (size_t i = bits.find_first(); i != s21::bit_vector::npos;
+       i = bits.find_next(i))
+    found.push_back(i);
+  ASSERT_EQ(found, positions);
+  bits.reset(0);
+  ASSERT_EQ(bits.find_first(), 63u);
+  ASSERT_TRUE(bits.test(64));
+  ASSERT_FALSE(bits.test(65));
+}
+
+TEST(BitVector, bulk_operations) {
+  s21::bit_vector a(130), b(130);
+  for (size_t i = 0; i < 130; i += 2) a.set(i);
+  for (size_t i = 0; i < 130; i += 3) b.set(i);
+  s21::bit_vector both(a), either(a), one(a);
+  both &= b;
+  either |= b;
+  one ^= b;
+  for (size_t i = 0; i < 130; ++i) {
+    ASSERT_EQ(both[i], i % 6 == 0);
+    ASSERT_EQ(either[i], i % 2 == 0 || i % 3 == 0);
+    ASSERT_EQ(one[i], (i % 2 == 0) != (i % 3 == 0));
+  }
+  s21::bit_vector inverted = ~a;
+  ASSERT_EQ(inverted.count(), 65u);
+  inverted ^= a;
+  ASSERT_TRUE(inverted.all());
+  s21::bit_vector shorter(10);
+  ASSERT_THROW(a &= shorter, std::invalid_argument);
+  a.set();
+  ASSERT_TRUE(a.all());
+  ASSERT_EQ(a.count(), 130u);
+  a.reset();
+  ASSERT_TRUE(a.none());
+}
+
+TEST(BitVector, resize) {
+  s21::bit_vector bits{true, false, true};
+  bits.resize(200, true);
+  ASSERT_EQ(bits.count(), 199u);
+  ASSERT_FALSE(bits[1]);
+  bits.resize(70);
+  ASSERT_EQ(bits.count(), 69u);
+  bits.resize(140);
+  ASSERT_EQ(bits.count(), 69u);
+  ASSERT_FALSE(bits.back());
+  s21::bit_vector copy = bits;
+  ASSERT_TRUE(copy == bits);
+  copy.flip(139);
+  ASSERT_TRUE(copy != bits);
+  bits.clear();
+  ASSERT_TRUE(bits.empty());
+}
+
+TEST(BitVector, count_kernels_agree) {
+  // Слова с крайними значениями и псевдослучайные
+  std::vector<uint64_t> words = {0, ~uint64_t{0}, uint64_t{1} << 63, 1};
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  for (int i = 0; i < 1000; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    words.push_back(state);
+  }
+  size_t expected = 0;
+  for (uint64_t word : words)
+    for (; word != 0; word &= word - 1) ++expected;
+  ASSERT_EQ(s21::__bit_count_portable(words.data(), words.size()), expected);
+  ASSERT_EQ(s21::__bit_count(words.data(), words.size()), expected);
+#ifdef S21_BIT_VECTOR_X86_KERNELS
+  if (__builtin_cpu_supports("popcnt")) {
+    ASSERT_EQ(s21::__bit_count_popcnt(words.data(), words.size()), expected);
+  }
+#endif
+  s21::bit_vector bits(words.size() * 64 - 5, true);
+  ASSERT_EQ(bits.count(), bits.size());
+}
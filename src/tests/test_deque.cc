@@ -371,4 +371,107 @@ TEST(test_container, deque_test_initlistconst2) {
   s21_deque.pop_back();
   orig_deque.pop_back();
   ASSERT_TRUE(s21_deque.back() == orig_deque.back());
-}
\ No newline at end of file
+}
+TEST(test_container, deque_test_random_access) {
+  s21::deque<int> s21_deque;
+  std::deque<int> orig_deque;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 == 0) {
+      s21_deque.push_front(i);
+      orig_deque.push_front(i);
+    } else {
+      s21_deque.push_back(i);
+      orig_deque.push_back(i);
+    }
+  }
+  ASSERT_TRUE(s21_deque.size() == orig_deque.size());
+  for (size_t i = 0; i < orig_deque.size(); ++i) {
+    ASSERT_TRUE(s21_deque[i] == orig_deque[i]);
+  }
+  ASSERT_TRUE(s21_deque.at(500) == orig_deque.at(500));
+  ASSERT_THROW(s21_deque.at(1000), std::out_of_range);
+  s21_deque[10] = -5;
+  orig_deque[10] = -5;
+  ASSERT_TRUE(std::equal(s21_deque.begin(), s21_deque.end(),
+                         orig_deque.begin(), orig_deque.end()));
+  std::sort(s21_deque.begin(), s21_deque.end());
+  std::sort(orig_deque.begin(), orig_deque.end());
+  ASSERT_TRUE(std::equal(s21_deque.begin(), s21_deque.end(),
+                         orig_deque.begin(), orig_deque.end()));
+  ASSERT_TRUE(s21_deque.end() - s21_deque.begin() == 1000);
+  ASSERT_TRUE(2 + s21_deque.begin() == s21_deque.begin() + 2);
+  const s21::deque<int> &view = s21_deque;
+  ASSERT_TRUE(*(3 + view.begin()) == orig_deque[3]);
+}
+
+namespace {
+// Значение, конструктор которого бросает исключение по флагу
+struct ThrowingValue {
+  static bool fail;
+  int value;
+  ThrowingValue(int v) : value(v) {
+    if (fail) throw std::runtime_error("construction failed");
+  }
+};
+bool ThrowingValue::fail = false;
+}  // namespace
+
+TEST(test_container, deque_test_throwing_constructor) {
+  {
+    // Пустой блок не должен остаться в карте после неудачной вставки
+    s21::deque<ThrowingValue> empty_deque;
+    ThrowingValue::fail = true;
+    ASSERT_THROW(empty_deque.emplace_back(1), std::runtime_error);
+    ASSERT_TRUE(empty_deque.empty());
+    ThrowingValue::fail = false;
+  }
+  s21::deque<ThrowingValue> s21_deque;
+  ThrowingValue::fail = true;
+  ASSERT_THROW(s21_deque.emplace_back(1), std::runtime_error);
+  ASSERT_THROW(s21_deque.emplace_front(1), std::runtime_error);
+  ASSERT_TRUE(s21_deque.empty());
+  ThrowingValue::fail = false;
+  for (int i = 0; i < 128; ++i) s21_deque.emplace_back(i);
+  ThrowingValue::fail = true;
+  // Новые блоки нужны с обеих сторон
+  ASSERT_THROW(s21_deque.emplace_back(0), std::runtime_error);
+  ASSERT_THROW(s21_deque.emplace_front(0), std::runtime_error);
+  ThrowingValue::fail = false;
+  ASSERT_EQ(s21_deque.size(), 128u);
+  s21_deque.emplace_front(-1);
+  s21_deque.emplace_back(128);
+  ASSERT_EQ(s21_deque.front().value, -1);
+  ASSERT_EQ(s21_deque.back().value, 128);
+  ASSERT_EQ(s21_deque[64].value, 63);
+}
+
+TEST(test_container, deque_test_sliding_window) {
+  // Очередь, которая долго сдвигается в одну сторону
+  s21::deque<std::string> s21_deque;
+  std::deque<std::string> orig_deque;
+  for (int i = 0; i < 5000; ++i) {
+    s21_deque.push_back(std::to_string(i));
+    orig_deque.push_back(std::to_string(i));
+    if (i % 7 != 0) {
+      s21_deque.pop_front();
+      orig_deque.pop_front();
+    }
+  }
+  ASSERT_TRUE(s21_deque.size() == orig_deque.size());
+  ASSERT_TRUE(s21_deque.front() == orig_deque.front());
+  ASSERT_TRUE(s21_deque.back() == orig_deque.back());
+  const std::string *address = &s21_deque[3];
+  for (int i = 0; i < 500; ++i) {
+    s21_deque.push_front("front");
+    s21_deque.push_back("back");
+  }
+  // Элементы не переезжают при росте карты
+  ASSERT_TRUE(address == &s21_deque[503]);
+  s21_deque.clear();
+  ASSERT_TRUE(s21_deque.empty());
+  s21_deque.pop_back();
+  s21_deque.pop_front();
+  ASSERT_TRUE(s21_deque.empty());
+  s21_deque.emplace_front(3, 'x');
+  ASSERT_TRUE(s21_deque.back() == "xxx");
+}
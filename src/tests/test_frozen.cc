@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+
+#include "test_headers.h"
+
+TEST(test_frozen, empty_map) {
+  s21::map<int, int> my_map;
+  s21::frozen_map<int, int> frozen = my_map.freeze();
+  ASSERT_TRUE(frozen.empty());
+  ASSERT_EQ(frozen.size(), 0u);
+  ASSERT_TRUE(frozen.begin() == frozen.end());
+  ASSERT_FALSE(frozen.contains(1));
+  ASSERT_TRUE(frozen.find(1) == frozen.end());
+  ASSERT_TRUE(frozen.lower_bound(1) == frozen.end());
+  ASSERT_THROW(frozen.at(1), std::out_of_range);
+}
+
+TEST(test_frozen, map_against_std_map) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(-5000, 5000);
+  s21::map<int, int> my_map;
+  std::map<int, int> real_map;
+  for (int i = 0; i < 1000; i++) {
+    int key = dist(gen);
+    my_map.insert(key, i);
+    real_map.insert(std::make_pair(key, i));
+  }
+  s21::frozen_map<int, int> frozen = my_map.freeze();
+  ASSERT_EQ(frozen.size(), real_map.size());
+  auto real_it = real_map.begin();
+  for (auto it = frozen.begin(); it != frozen.end(); ++it, ++real_it) {
+    ASSERT_EQ(it.getKey(), real_it->first);
+    ASSERT_EQ(it.getValue(), real_it->second);
+    ASSERT_EQ((*it).second, real_it->second);
+  }
+  ASSERT_TRUE(real_it == real_map.end());
+  for (int key = -5100; key <= 5100; key += 13) {
+    auto real_found = real_map.find(key);
+    ASSERT_EQ(frozen.contains(key), real_found != real_map.end());
+    if (real_found != real_map.end()) {
+      ASSERT_EQ(frozen.at(key), real_found->second);
+      ASSERT_EQ(frozen.find(key).getValue(), real_found->second);
+    }
+    auto real_lb = real_map.lower_bound(key);
+    auto lb = frozen.lower_bound(key);
+    ASSERT_EQ(lb == frozen.end(), real_lb == real_map.end());
+    if (real_lb != real_map.end()) {
+      ASSERT_EQ(lb.getKey(), real_lb->first);
+    }
+  }
+}
+
+TEST(test_frozen, set_against_std_set) {
+  s21::set<int> my_set;
+  std::set<int> real_set;
+  for (int i = 0; i < 100; i++) {
+    my_set.insert(i * 7 % 101);
+    real_set.insert(i * 7 % 101);
+  }
+  s21::frozen_set<int> frozen = my_set.freeze();
+  ASSERT_EQ(frozen.size(), real_set.size());
+  auto real_it = real_set.begin();
+  for (auto it = frozen.begin(); it != frozen.end(); it++, ++real_it) {
+    ASSERT_EQ(it.getKey(), *real_it);
+  }
+  for (int key = -2; key < 105; key++) {
+    ASSERT_EQ(frozen.contains(key), real_set.count(key) == 1);
+    auto real_lb = real_set.lower_bound(key);
+    auto lb = frozen.lower_bound(key);
+    ASSERT_EQ(lb == frozen.end(), real_lb == real_set.end());
+    if (lb != frozen.end()) {
+      ASSERT_EQ(lb.getKey(), *real_lb);
+    }
+  }
+}
+
+TEST(test_frozen, range_for_and_algorithms) {
+  s21::set<std::string> my_set;
+  for (const char* word : {"pear", "apple", "fig", "kiwi"}) {
+    my_set.insert(word);
+  }
+  s21::frozen_set<std::string> frozen = my_set.freeze();
+  std::vector<std::string> words;
+  for (const auto& word : frozen) words.push_back(word);
+  ASSERT_EQ(words,
+            (std::vector<std::string>{"apple", "fig", "kiwi", "pear"}));
+  ASSERT_EQ(std::vector<std::string>(frozen.begin(), frozen.end()), words);
+  ASSERT_EQ(std::distance(frozen.begin(), frozen.end()), 4);
+  auto found = std::find(frozen.begin(), frozen.end(), "kiwi");
+  ASSERT_EQ(found->size(), 4u);
+  ASSERT_TRUE(std::is_sorted(frozen.begin(), frozen.end()));
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 10; i++) my_map.insert(i, i * i);
+  s21::frozen_map<int, int> frozen_map = my_map.freeze();
+  int sum = 0;
+  for (auto [key, value] : frozen_map) sum += value - key;
+  ASSERT_EQ(sum, 240);
+}
+
+TEST(test_frozen, map_mismatched_sizes_throw) {
+  ASSERT_THROW((s21::frozen_map<int, int>({1, 2}, {1})),
+               std::invalid_argument);
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+
+#include "test_headers.h"
+
+namespace {
+using Interval = std::tuple<int, int, int>;
+
+std::vector<Interval> Collect(
+    std::vector<s21::interval_map<int, int>::iterator> found) {
+  std::vector<Interval> result;
+  for (auto& it : found) {
+    result.emplace_back(it.getKey(), it.getEnd(), it.getValue());
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+// Дает тестам доступ к корню, чтобы измерить высоту дерева
+class HeightProbe : public s21::interval_map<int, int> {
+ public:
+  size_t height() const {
+    size_t result = 0;
+    std::vector<std::pair<Node<int, s21::interval_entry<int, int>>*, size_t>>
+        nodes;
+    if (root != nullptr) nodes.emplace_back(root, 1);
+    while (!nodes.empty()) {
+      auto [node, depth] = nodes.back();
+      nodes.pop_back();
+      result = std::max(result, depth);
+      if (node->left != nullptr) nodes.emplace_back(node->left, depth + 1);
+      if (node->right != nullptr) nodes.emplace_back(node->right, depth + 1);
+    }
+    return result;
+  }
+};
+
+std::vector<Interval> BruteForce(const std::vector<Interval>& all, int lo,
+                                 int hi) {
+  std::vector<Interval> result;
+  for (auto& interval : all) {
+    if (std::get<0>(interval) < hi && lo < std::get<1>(interval)) {
+      result.push_back(interval);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+}  // namespace
+
+TEST(test_interval_map, empty_map) {
+  s21::interval_map<int, int> intervals;
+  ASSERT_TRUE(intervals.empty());
+  ASSERT_EQ(intervals.size(), 0u);
+  ASSERT_TRUE(intervals.overlapping(5).empty());
+  ASSERT_TRUE(intervals.overlapping(0, 10).empty());
+}
+
+TEST(test_interval_map, insert_and_point_query) {
+  s21::interval_map<int, int> intervals;
+  intervals.insert(1, 5, 10);
+  intervals.insert(3, 8, 20);
+  intervals.insert(10, 12, 30);
+  intervals.insert(3, 4, 40);
+  ASSERT_EQ(intervals.size(), 4u);
+  ASSERT_EQ(Collect(intervals.overlapping(3)),
+            (std::vector<Interval>{{1, 5, 10}, {3, 4, 40}, {3, 8, 20}}));
+  ASSERT_EQ(Collect(intervals.overlapping(5)),
+            (std::vector<Interval>{{3, 8, 20}}));
+  ASSERT_TRUE(intervals.overlapping(8).empty());
+  ASSERT_EQ(Collect(intervals.overlapping(11)),
+            (std::vector<Interval>{{10, 12, 30}}));
+}
+
+TEST(test_interval_map, range_query_is_half_open) {
+  s21::interval_map<int, int> intervals;
+  intervals.insert(0, 5, 1);
+  intervals.insert(5, 10, 2);
+  ASSERT_EQ(Collect(intervals.overlapping(5, 6)),
+            (std::vector<Interval>{{5, 10, 2}}));
+  ASSERT_EQ(Collect(intervals.overlapping(4, 5)),
+            (std::vector<Interval>{{0, 5, 1}}));
+  ASSERT_TRUE(intervals.overlapping(3, 3).empty());
+}
+
+TEST(test_interval_map, empty_interval_throws) {
+  s21::interval_map<int, int> intervals;
+  ASSERT_THROW(intervals.insert(5, 5, 0), std::invalid_argument);
+  ASSERT_THROW(intervals.insert(6, 5, 0), std::invalid_argument);
+}
+
+TEST(test_interval_map, random_against_brute_force) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> start_dist(0, 1000);
+  std::uniform_int_distribution<int> length_dist(1, 50);
+  s21::interval_map<int, int> intervals;
+  std::vector<Interval> all;
+  for (int i = 0; i < 500; ++i) {
+    int start = start_dist(gen);
+    int end = start + length_dist(gen);
+    intervals.insert(start, end, i);
+    all.emplace_back(start, end, i);
+  }
+  for (int i = 0; i < 200; ++i) {
+    int lo = start_dist(gen);
+    int hi = lo + length_dist(gen);
+    ASSERT_EQ(Collect(intervals.overlapping(lo, hi)), BruteForce(all, lo, hi));
+    ASSERT_EQ(Collect(intervals.overlapping(lo)), BruteForce(all, lo, lo + 1));
+  }
+}
+
+TEST(test_interval_map, erase_keeps_queries_correct) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> start_dist(0, 500);
+  std::uniform_int_distribution<int> length_dist(1, 100);
+  s21::interval_map<int, int> intervals;
+  std::vector<Interval> all;
+  for (int i = 0; i < 300; ++i) {
+    int start = start_dist(gen);
+    int end = start + length_dist(gen);
+    intervals.insert(start, end, i);
+    all.emplace_back(start, end, i);
+  }
+  for (int round = 0; round < 150; ++round) {
+    auto found = intervals.overlapping(start_dist(gen));
+    if (found.empty()) continue;
+    auto victim = found.front();
+    Interval removed(victim.getKey(), victim.getEnd(), victim.getValue());
+    intervals.erase(victim);
+    all.erase(std::find(all.begin(), all.end(), removed));
+    ASSERT_EQ(intervals.size(), all.size());
+    for (int point = 0; point < 600; point += 37) {
+      ASSERT_EQ(Collect(intervals.overlapping(point)),
+                BruteForce(all, point, point + 1));
+    }
+  }
+}
+
+TEST(test_interval_map, copy_and_move) {
+  s21::interval_map<int, int> intervals;
+  intervals.insert(1, 4, 1);
+  intervals.insert(2, 9, 2);
+  s21::interval_map<int, int> copy(intervals);
+  ASSERT_EQ(Collect(copy.overlapping(3)), Collect(intervals.overlapping(3)));
+  s21::interval_map<int, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(Collect(moved.overlapping(8)),
+            (std::vector<Interval>{{2, 9, 2}}));
+}
+
+TEST(test_interval_map, sorted_inserts_stay_balanced) {
+  const int count = 100000;
+  HeightProbe intervals;
+  for (int i = 0; i < count; ++i) intervals.insert(i, i + 3, i);
+  // Высота красно-черного дерева не больше 2 * log2(n + 1)
+  ASSERT_LE(intervals.height(), 34u);
+  ASSERT_EQ(Collect(intervals.overlapping(count - 1)),
+            (std::vector<Interval>{{count - 3, count, count - 3},
+                                   {count - 2, count + 1, count - 2},
+                                   {count - 1, count + 2, count - 1}}));
+  ASSERT_EQ(intervals.overlapping(0, count).size(), size_t(count));
+  // Удаляем каждый второй интервал, max_end должен остаться верным
+  auto it = intervals.begin();
+  for (int i = 0; i < count / 2; ++i) {
+    auto next = it;
+    ++next;
+    ++next;
+    intervals.erase(it);
+    it = next;
+  }
+  ASSERT_LE(intervals.height(), 34u);
+  ASSERT_EQ(intervals.size(), size_t(count / 2));
+  ASSERT_EQ(Collect(intervals.overlapping(50000)),
+            (std::vector<Interval>{{49999, 50002, 49999}}));
+  ASSERT_EQ(Collect(intervals.overlapping(count - 1)),
+            (std::vector<Interval>{{count - 3, count, count - 3},
+                                   {count - 1, count + 2, count - 1}}));
+}
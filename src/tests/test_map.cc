@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
 #include <map>
 
 #include "test_headers.h"
@@ -463,3 +466,295 @@ TEST(test_map, map_test_merge_test) {
     it++;
   }
 }
+
+TEST(test_map, map_test_find_batch) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 1000; i += 3) {
+    my_map.insert(i, i * 10);
+  }
+  std::vector<int> keys;
+  for (int i = 1100; i >= -50; i -= 7) {
+    keys.push_back(i);
+  }
+  keys.push_back(300);
+  keys.push_back(300);
+  std::vector<s21::map<int, int>::iterator> found;
+  my_map.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    ASSERT_EQ(found[i].iter_is_nullptr(), !my_map.contains(keys[i]));
+    if (!found[i].iter_is_nullptr()) {
+      ASSERT_EQ(found[i].getKey(), keys[i]);
+      ASSERT_EQ(found[i].getValue(), keys[i] * 10);
+    }
+  }
+}
+
+TEST(test_map, map_test_find_batch_matches_find) {
+  // Ключей больше, чем дорожек спуска, и спуски заканчиваются на разной
+  // глубине, поэтому дорожки многократно освобождаются и занимаются снова
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 20000; i++) {
+    my_map.insert(i * 7919 % 40009, i);
+  }
+  std::vector<int> keys;
+  for (int i = 0; i < 30000; i++) {
+    keys.push_back(static_cast<int>(i * 104729LL % 45007) - 2000);
+  }
+  std::vector<s21::map<int, int>::iterator> found;
+  my_map.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    ASSERT_EQ(found[i].iter_is_nullptr(), !my_map.contains(keys[i]));
+    if (!found[i].iter_is_nullptr()) {
+      ASSERT_EQ(found[i].getKey(), keys[i]);
+      ASSERT_EQ(found[i].getValue(), my_map.at(keys[i]));
+    }
+  }
+}
+
+TEST(test_map, map_test_contains_batch) {
+  s21::map<int, int> my_map{std::make_pair(1, 1), std::make_pair(5, 5),
+                            std::make_pair(9, 9)};
+  int keys[] = {9, 2, 1, 5, 10, 0};
+  bool result[6] = {};
+  my_map.contains_batch(keys, keys + 6, result);
+  bool expected[] = {true, false, true, true, false, false};
+  for (int i = 0; i < 6; i++) {
+    ASSERT_EQ(result[i], expected[i]);
+  }
+  s21::map<int, int> empty_map;
+  empty_map.contains_batch(keys, keys + 6, result);
+  for (int i = 0; i < 6; i++) {
+    ASSERT_FALSE(result[i]);
+  }
+}
+
+TEST(test_map, map_test_save_load) {
+  std::string path = testing::TempDir() + "s21_map_save_load.bin";
+  s21::map<int, double> my_map;
+  for (int i = 0; i < 1000; i++) {
+    my_map.insert(i * 7 % 1009, i * 0.5);
+  }
+  my_map.save(path);
+  s21::map<int, double> loaded{std::make_pair(-1, 0.0)};
+  loaded.load(path);
+  ASSERT_EQ(loaded.size(), my_map.size());
+  ASSERT_FALSE(loaded.contains(-1));
+  auto it = my_map.begin();
+  auto loaded_it = loaded.begin();
+  for (size_t i = 0; i < my_map.size(); i++, ++it, ++loaded_it) {
+    ASSERT_EQ(loaded_it.getKey(), it.getKey());
+    ASSERT_EQ(loaded_it.getValue(), it.getValue());
+  }
+  loaded.insert(5000, 1.0);
+  ASSERT_EQ(loaded.at(5000), 1.0);
+  ASSERT_EQ(loaded.end().getKey(), 5000);
+  std::remove(path.c_str());
+}
+
+TEST(test_map, map_test_load_errors) {
+  std::string path = testing::TempDir() + "s21_map_load_errors.bin";
+  s21::map<int, int> my_map;
+  ASSERT_THROW(my_map.load(path + ".missing"), std::runtime_error);
+  s21::set<int> my_set{1, 2, 3};
+  my_set.save(path);
+  ASSERT_THROW(my_map.load(path), std::runtime_error);
+  s21::map<long, int> wide_map{std::make_pair(1L, 1)};
+  wide_map.save(path);
+  ASSERT_THROW(my_map.load(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+namespace {
+// Переписывает поле заголовка сохраненного файла
+template <typename T>
+void PatchFile(const std::string& path, size_t offset, T value) {
+  std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(offset);
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+}  // namespace
+
+TEST(test_map, map_test_load_rejects_malformed_headers) {
+  std::string path = testing::TempDir() + "s21_map_malformed.bin";
+  s21::map<int, int> my_map;
+  s21::map<int, double> source;
+  for (int i = 0; i < 10; i++) source.insert(i, i * 0.5);
+  s21::map<int, double> loaded;
+  // Файл словаря не читается как множество и наоборот
+  source.save(path);
+  s21::set<int> my_set;
+  s21::multiset<int> my_multiset;
+  ASSERT_THROW(my_set.load(path), std::runtime_error);
+  ASSERT_THROW(my_multiset.load(path), std::runtime_error);
+  ASSERT_THROW(s21::mapped_set<int>{path}, std::runtime_error);
+  s21::set<int>{1, 2}.save(path);
+  ASSERT_THROW(my_map.load(path), std::runtime_error);
+  ASSERT_THROW((s21::mapped_map<int, int>{path}), std::runtime_error);
+  // Обрезанный файл
+  source.save(path);
+  std::ifstream in(path, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream(path, std::ios::binary | std::ios::trunc)
+      .write(bytes.data(), bytes.size() - 1);
+  ASSERT_THROW(loaded.load(path), std::runtime_error);
+  // Количество, при котором count * sizeof(Key) переполняется
+  source.save(path);
+  const size_t count_offset = offsetof(SortedFileHeader, count);
+  PatchFile<uint64_t>(path, count_offset, uint64_t{1} << 62);
+  ASSERT_THROW(loaded.load(path), std::runtime_error);
+  ASSERT_THROW((s21::mapped_map<int, double>{path}), std::runtime_error);
+  // Значения не выровнены или перекрывают ключи
+  const size_t values_offset = offsetof(SortedFileHeader, values_offset);
+  for (uint64_t offset : {64 + 40 + 4, 64 + 32}) {
+    source.save(path);
+    PatchFile<uint64_t>(path, values_offset, offset);
+    ASSERT_THROW(loaded.load(path), std::runtime_error);
+  }
+  // Неизвестные флаги и неверный размер значения
+  source.save(path);
+  PatchFile<uint32_t>(path, offsetof(SortedFileHeader, flags), 1u | 2u | 8u);
+  ASSERT_THROW(loaded.load(path), std::runtime_error);
+  source.save(path);
+  PatchFile<uint32_t>(path, offsetof(SortedFileHeader, value_size), 4u);
+  ASSERT_THROW(loaded.load(path), std::runtime_error);
+  // Ключи не по порядку
+  source.save(path);
+  PatchFile<int>(path, sizeof(SortedFileHeader) + sizeof(int), 100);
+  ASSERT_THROW(loaded.load(path), std::invalid_argument);
+  ASSERT_THROW((s21::mapped_map<int, double>{path}), std::invalid_argument);
+  // Повтор ключа недопустим, только если файл обещает уникальность
+  s21::set<int>{1, 2, 3}.save(path);
+  PatchFile<int>(path, sizeof(SortedFileHeader) + sizeof(int), 1);
+  ASSERT_THROW(my_set.load(path), std::invalid_argument);
+  ASSERT_THROW(s21::mapped_set<int>{path}, std::invalid_argument);
+  PatchFile<uint32_t>(path, offsetof(SortedFileHeader, flags), 0u);
+  my_multiset.load(path);
+  ASSERT_EQ(my_multiset.count(1), 2u);
+  ASSERT_EQ(s21::mapped_set<int>{path}.count(1), 2u);
+  // Исправный файл по-прежнему загружается
+  source.save(path);
+  loaded.load(path);
+  ASSERT_EQ(loaded.at(7), 3.5);
+  std::remove(path.c_str());
+}
+
+TEST(test_map, map_test_mapped_view) {
+  std::string path = testing::TempDir() + "s21_map_mapped_view.bin";
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 100; i++) {
+    my_map.insert(i * 3, i);
+  }
+  my_map.save(path);
+  s21::mapped_map<int, int> view(path);
+  ASSERT_EQ(view.size(), 100u);
+  for (int key = -1; key < 302; key++) {
+    ASSERT_EQ(view.contains(key), my_map.contains(key));
+    if (view.contains(key)) {
+      ASSERT_EQ(view.at(key), my_map.at(key));
+    }
+  }
+  ASSERT_THROW(view.at(1), std::out_of_range);
+  ASSERT_EQ(view.rank(4), 2u);
+  ASSERT_EQ(view.key(2), 6);
+  ASSERT_EQ(view.value(2), 2);
+  std::remove(path.c_str());
+}
+
+namespace {
+// Словарь, в котором можно вручную собрать вырожденное дерево-цепочку
+class ChainMap : public s21::map<int, int> {
+ public:
+  void BuildChain(int count) {
+    clear();
+    Node<int, int>* last = nullptr;
+    for (int i = 0; i < count; i++) {
+      Node<int, int>* node = new Node<int, int>{i, i, last, nullptr, nullptr,
+                                                Black};
+      if (last == nullptr) {
+        root = node;
+      } else {
+        last->right = node;
+      }
+      last = node;
+    }
+  }
+};
+}  // namespace
+
+TEST(test_map, map_test_deep_tree_copy_and_free) {
+  ChainMap chain;
+  chain.BuildChain(1000000);
+  s21::map<int, int> copy(chain);
+  ASSERT_EQ(copy.begin().getKey(), 0);
+  ASSERT_EQ(copy.end().getKey(), 999999);
+  ASSERT_EQ(copy.at(123456), 123456);
+  RBtree<int, int>& tree = copy;
+  ASSERT_EQ(tree.size(), 1000000u);
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+}
+
+namespace {
+// Значение, копирование которого бросает исключение после заданного числа
+// копий. alive считает живые объекты, чтобы найти утечки
+struct FragileValue {
+  static std::atomic<int> alive;
+  static std::atomic<int> copies_left;
+  int value = 0;
+  FragileValue() { ++alive; }
+  FragileValue(int v) : value(v) { ++alive; }
+  FragileValue(const FragileValue& other) : value(other.value) { ++alive; }
+  FragileValue& operator=(const FragileValue& other) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    value = other.value;
+    return *this;
+  }
+  ~FragileValue() { --alive; }
+};
+std::atomic<int> FragileValue::alive{0};
+std::atomic<int> FragileValue::copies_left{-1};
+}  // namespace
+
+TEST(test_map, map_test_copy_failure_frees_partial_copy) {
+  {
+    s21::map<int, FragileValue> source;
+    for (int i = 0; i < 5000; i++) source.insert(i, FragileValue(i));
+    const int alive = FragileValue::alive;
+    for (unsigned threads : {1u, 8u}) {
+      for (int fail_after : {0, 1, 2500, 4999}) {
+        s21::map<int, FragileValue> copy;
+        FragileValue::copies_left = fail_after;
+        ASSERT_THROW(copy.CopyFrom(source, threads), std::runtime_error);
+        FragileValue::copies_left = -1;
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(FragileValue::alive, alive);
+      }
+    }
+  }
+  ASSERT_EQ(FragileValue::alive, 0);
+}
+
+TEST(test_map, map_test_copy_parallel) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 10000; i++) {
+    my_map.insert(i * 31 % 10007, i);
+  }
+  for (unsigned threads : {0u, 1u, 3u, 8u}) {
+    s21::map<int, int> copy{std::make_pair(-1, -1)};
+    copy.CopyFrom(my_map, threads);
+    ASSERT_EQ(copy.size(), my_map.size());
+    ASSERT_FALSE(copy.contains(-1));
+    auto it = my_map.begin();
+    auto copy_it = copy.begin();
+    for (size_t i = 0; i < my_map.size(); i++, ++it, ++copy_it) {
+      ASSERT_EQ(copy_it.getKey(), it.getKey());
+      ASSERT_EQ(copy_it.getValue(), it.getValue());
+    }
+    copy.insert(20000, 1);
+    ASSERT_EQ(copy.end().getKey(), 20000);
+  }
+}
@@ -0,0 +1,93 @@
+#include "test_headers.h"
+
+namespace {
+struct Record {
+  int id;
+  double weight;
+};
+}  // namespace
+
+TEST(MappedVector, persists_records) {
+  std::string path = testing::TempDir() + "s21_mapped_vector.bin";
+  std::remove(path.c_str());
+  {
+    s21::mapped_vector<Record> records(path);
+    ASSERT_TRUE(records.empty());
+    for (int i = 0; i < 1000; ++i) records.push_back({i, i * 0.5});
+    ASSERT_EQ(records.size(), 1000u);
+    ASSERT_EQ(records.capacity(), 1024u);
+    records.sync();
+  }
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(static_cast<size_t>(file.tellg()), 1000 * sizeof(Record));
+  file.close();
+  s21::mapped_vector<Record> records(path);
+  ASSERT_EQ(records.size(), 1000u);
+  records.advise(s21::mapped_vector<Record>::access::sequential);
+  double total = 0;
+  for (const Record& record : records) total += record.weight;
+  ASSERT_DOUBLE_EQ(total, 999 * 1000 / 4.0);
+  ASSERT_EQ(records.at(999).id, 999);
+  ASSERT_THROW(records.at(1000), std::out_of_range);
+  records.close();
+  std::remove(path.c_str());
+}
+
+TEST(MappedVector, resize_and_move) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_resize.bin";
+  std::remove(path.c_str());
+  s21::mapped_vector<uint32_t> numbers(path);
+  numbers.resize(10);
+  numbers.emplace_back(7u);
+  numbers.push_back(numbers[10]);
+  ASSERT_EQ(numbers.size(), 12u);
+  ASSERT_EQ(numbers.back(), 7u);
+  numbers.pop_back();
+  numbers.resize(3);
+  numbers.resize(5);
+  ASSERT_EQ(numbers[4], 0u);
+  numbers.reserve(100);
+  numbers.shrink_to_fit();
+  ASSERT_EQ(numbers.capacity(), 5u);
+  s21::mapped_vector<uint32_t> moved(std::move(numbers));
+  ASSERT_EQ(moved.size(), 5u);
+  ASSERT_EQ(numbers.size(), 0u);
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  moved.close();
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(file.tellg(), 0);
+  std::remove(path.c_str());
+  ASSERT_THROW(s21::mapped_vector<int>(testing::TempDir() + "missing/dir.bin"),
+               std::runtime_error);
+}
+
+TEST(MappedVector, sync_trims_and_partial_records) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_sync.bin";
+  std::remove(path.c_str());
+  s21::mapped_vector<uint64_t> numbers(path);
+  for (uint64_t i = 0; i < 5; ++i) numbers.push_back(i);
+  ASSERT_EQ(numbers.capacity(), 8u);
+  // После sync файл совпадает с вектором, даже если его не закрыть
+  numbers.sync();
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(static_cast<size_t>(file.tellg()), 5 * sizeof(uint64_t));
+  file.close();
+  s21::mapped_vector<uint64_t> reader(path);
+  ASSERT_EQ(reader.size(), 5u);
+  ASSERT_EQ(reader[4], 4u);
+  reader.close();
+  numbers.push_back(5);
+  ASSERT_EQ(numbers.back(), 5u);
+  numbers.close();
+  // Хвост в половину записи не считается записью
+  {
+    std::ofstream append(path, std::ios::binary | std::ios::app);
+    append.write("tail", 4);
+  }
+  ASSERT_THROW(s21::mapped_vector<uint64_t>{path}, std::runtime_error);
+  s21::mapped_vector<uint32_t> halves(path);
+  ASSERT_EQ(halves.size(), 13u);
+  halves.close();
+  std::remove(path.c_str());
+}
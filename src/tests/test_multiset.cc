@@ -235,4 +235,21 @@ TEST(MultisetTest, InsertMany) {
     ASSERT_TRUE(it.getKey() == resultat[i]);
     ++it;
   }
-}
\ No newline at end of file
+}
+TEST(MultisetTest, SaveLoad) {
+  std::string path = testing::TempDir() + "s21_multiset_save_load.bin";
+  s21::multiset<int> ms = {4, 1, 4, 2, 4, 3, 1};
+  ms.save(path);
+  s21::multiset<int> loaded;
+  loaded.load(path);
+  EXPECT_EQ(loaded.size(), 7u);
+  for (int key = 0; key <= 5; key++) {
+    EXPECT_EQ(loaded.count(key), ms.count(key));
+  }
+  s21::set<int> unique;
+  EXPECT_THROW(unique.load(path), std::runtime_error);
+  s21::mapped_set<int> view(path);
+  EXPECT_EQ(view.count(4), 3u);
+  EXPECT_EQ(view.count(5), 0u);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,112 @@
+#include "test_headers.h"
+
+namespace {
+void random_values(s21::vector<int>& result, size_t n) {
+  unsigned state = 12345;
+  for (size_t i = 0; i < n; ++i) {
+    state = state * 1103515245u + 12345u;
+    result.push_back(static_cast<int>((state >> 8) % 100000));
+  }
+}
+}  // namespace
+
+TEST(Parallel, sort) {
+  s21::vector<int> values;
+  random_values(values, 200000);
+  std::vector<int> expected(values.begin(), values.end());
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::sort(values, std::less<>(), 1000);
+  ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  s21::parallel::sort(values.begin(), values.end(), std::greater<>());
+  ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+
+TEST(Parallel, stable_sort) {
+  s21::vector<std::pair<int, int>> values;
+  s21::vector<int> keys;
+  random_values(keys, 50000);
+  for (size_t i = 0; i < keys.size(); ++i)
+    values.push_back({keys[i] % 100, static_cast<int>(i)});
+  std::vector<std::pair<int, int>> expected(values.begin(), values.end());
+  auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  s21::parallel::stable_sort(values, by_key, 777);
+  ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(Parallel, for_each_and_transform) {
+  s21::array<int, 1000> items;
+  for (size_t i = 0; i < items.size(); ++i) items[i] = static_cast<int>(i);
+  s21::parallel::for_each(items, [](int& item) { item *= 2; }, 64);
+  s21::vector<long> doubled(1000);
+  s21::parallel::transform(
+      items, doubled.begin(), [](int item) { return item + 1L; }, 10);
+  for (size_t i = 0; i < items.size(); ++i) {
+    ASSERT_EQ(items[i], static_cast<int>(2 * i));
+    ASSERT_EQ(doubled[i], static_cast<long>(2 * i + 1));
+  }
+}
+
+TEST(Parallel, reduce_and_scan) {
+  s21::vector<int> values;
+  random_values(values, 100000);
+  long long expected = std::accumulate(values.begin(), values.end(), 0LL);
+  ASSERT_EQ(s21::parallel::reduce(values, 0LL, std::plus<>(), 999), expected);
+  ASSERT_EQ(s21::parallel::reduce(values.begin(), values.end(), 0LL),
+            expected);
+  // Некоммутативная операция: куски должны склеиваться по порядку
+  s21::vector<std::string> words = {"a", "b", "c", "d", "e", "f", "g"};
+  ASSERT_EQ(s21::parallel::reduce(words, std::string(), std::plus<>(), 2),
+            "abcdefg");
+  // Префиксные суммы выходят за int, поэтому сканируется long long
+  s21::vector<long long> wide;
+  for (int value : values) wide.push_back(value);
+  s21::vector<long long> prefix(wide.size());
+  s21::parallel::inclusive_scan(wide, prefix.begin(), std::plus<>(), 333);
+  std::vector<long long> expected_prefix(wide.size());
+  std::partial_sum(wide.begin(), wide.end(), expected_prefix.begin());
+  ASSERT_TRUE(std::equal(prefix.begin(), prefix.end(),
+                         expected_prefix.begin()));
+  ASSERT_EQ(s21::parallel::reduce(prefix.begin(), prefix.begin()), 0LL);
+}
+
+TEST(Parallel, partition) {
+  s21::vector<int> values;
+  random_values(values, 30000);
+  std::vector<int> expected(values.begin(), values.end());
+  auto even = [](int item) { return item % 2 == 0; };
+  auto middle = std::stable_partition(expected.begin(), expected.end(), even);
+  int* split = s21::parallel::partition(values, even, 500);
+  ASSERT_EQ(split - values.begin(), middle - expected.begin());
+  ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(Parallel, task_group) {
+  s21::parallel::thread_pool pool(2);
+  std::atomic<int> done{0};
+  {
+    s21::parallel::task_group group(pool);
+    for (int i = 0; i < 100; ++i) group.run([&done]() { ++done; });
+    group.wait();
+    ASSERT_EQ(done.load(), 100);
+    group.run([]() { throw std::runtime_error("task failed"); });
+    ASSERT_THROW(group.wait(), std::runtime_error);
+  }
+  // Пул без рабочих потоков: задачи выполняет ждущий поток
+  s21::parallel::thread_pool empty(0);
+  s21::parallel::task_group group(empty);
+  group.run([&done]() { ++done; });
+  group.wait();
+  ASSERT_EQ(done.load(), 101);
+}
+
+TEST(Parallel, thread_count_from_environment) {
+  using pool = s21::parallel::thread_pool;
+  ASSERT_EQ(setenv("S21_THREADS", "3", 1), 0);
+  EXPECT_EQ(pool::default_threads(), 3u);
+  ASSERT_EQ(setenv("S21_THREADS", "0", 1), 0);
+  EXPECT_EQ(pool::default_threads(),
+            std::max(std::thread::hardware_concurrency(), 1u));
+  ASSERT_EQ(unsetenv("S21_THREADS"), 0);
+  EXPECT_GE(pool::default_threads(), 1u);
+}
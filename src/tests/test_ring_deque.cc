@@ -0,0 +1,143 @@
+#include "test_headers.h"
+
+TEST(RingDeque, both_ends_and_growth) {
+  s21::ring_deque<int> d;
+  std::deque<int> orig;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3 == 0) {
+      d.push_front(i);
+      orig.push_front(i);
+    } else {
+      d.push_back(i);
+      orig.push_back(i);
+    }
+  }
+  ASSERT_EQ(d.size(), orig.size());
+  // Емкость всегда степень двойки
+  ASSERT_EQ(d.capacity(), 128u);
+  for (size_t i = 0; i < orig.size(); ++i) ASSERT_EQ(d[i], orig[i]);
+  ASSERT_EQ(d.front(), orig.front());
+  ASSERT_EQ(d.back(), orig.back());
+  ASSERT_THROW(d.at(100), std::out_of_range);
+  ASSERT_TRUE(std::equal(d.begin(), d.end(), orig.begin(), orig.end()));
+  ASSERT_TRUE(5 + d.begin() == d.begin() + 5);
+  ASSERT_EQ(*(5 + d.begin()), orig[5]);
+  while (!orig.empty()) {
+    ASSERT_EQ(d.front(), orig.front());
+    d.pop_front();
+    orig.pop_front();
+    if (!orig.empty()) {
+      ASSERT_EQ(d.back(), orig.back());
+      d.pop_back();
+      orig.pop_back();
+    }
+  }
+  ASSERT_TRUE(d.empty());
+  d.pop_front();
+  ASSERT_TRUE(d.empty());
+}
+
+TEST(RingDeque, iterator_survives_growth) {
+  s21::ring_deque<int> d{1, 2, 3};
+  s21::ring_deque<int>::iterator it = d.begin() + 1;
+  // Итератор хранит номер элемента, а не адрес
+  for (int i = 4; i < 100; ++i) d.push_back(i);
+  ASSERT_EQ(*it, 2);
+  s21::ring_deque<int>::const_iterator last = it + 98;
+  ASSERT_TRUE(last == d.end());
+  ASSERT_EQ(last - it, 98);
+  ASSERT_TRUE(it < last);
+  const s21::ring_deque<int>& view = d;
+  ASSERT_EQ(view.end() - view.begin(), 99);
+}
+
+TEST(RingDeque, segments_cover_wrapped_ring) {
+  s21::ring_deque<int> d;
+  d.reserve(8);
+  for (int i = 0; i < 8; ++i) d.push_back(i);
+  for (int i = 0; i < 5; ++i) d.pop_front();
+  for (int i = 8; i < 13; ++i) d.push_back(i);
+  ASSERT_EQ(d.capacity(), 8u);
+  auto parts = d.segments();
+  ASSERT_EQ(parts.first.size(), 3u);
+  ASSERT_EQ(parts.second.size(), 5u);
+  std::vector<int> joined(parts.first.begin(), parts.first.end());
+  joined.insert(joined.end(), parts.second.begin(), parts.second.end());
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(joined[i], i + 5);
+  // При росте кольцо разворачивается в один кусок
+  d.push_back(13);
+  ASSERT_EQ(d.capacity(), 16u);
+  parts = d.segments();
+  ASSERT_EQ(parts.first.size(), 9u);
+  ASSERT_TRUE(parts.second.empty());
+  for (int i = 0; i < 9; ++i) ASSERT_EQ(parts.first[i], i + 5);
+}
+
+TEST(RingDeque, copy_move_and_strings) {
+  s21::ring_deque<std::string> d{"b", "c"};
+  d.push_front("a");
+  for (int i = 0; i < 20; ++i) d.push_back(d.front());
+  ASSERT_EQ(d.size(), 23u);
+  ASSERT_EQ(d.back(), "a");
+  s21::ring_deque<std::string> copy(d);
+  s21::ring_deque<std::string> moved(std::move(d));
+  ASSERT_TRUE(d.empty());
+  ASSERT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin(),
+                         moved.end()));
+  d = copy;
+  ASSERT_EQ(d.size(), 23u);
+  ASSERT_EQ(d[2], "c");
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+  copy = std::move(d);
+  ASSERT_EQ(copy[1], "b");
+}
+
+namespace {
+// Тип без noexcept-перемещения: при росте элементы копируются, и копия
+// может бросить исключение
+struct FragileCopy {
+  static int copies_left;
+  std::string text;
+  explicit FragileCopy(std::string t) : text(std::move(t)) {}
+  FragileCopy(const FragileCopy& other) : text(other.text) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  FragileCopy(FragileCopy&& other) : text(std::move(other.text)) {}
+};
+int FragileCopy::copies_left = -1;
+}  // namespace
+
+TEST(RingDeque, growth_is_exception_safe) {
+  s21::ring_deque<FragileCopy> d;
+  for (int i = 0; i < 8; ++i) d.emplace_front(std::to_string(i));
+  ASSERT_EQ(d.capacity(), 8u);
+  FragileCopy::copies_left = 5;
+  ASSERT_THROW(d.emplace_back("x"), std::runtime_error);
+  FragileCopy::copies_left = -1;
+  // Старый буфер не тронут
+  ASSERT_EQ(d.size(), 8u);
+  ASSERT_EQ(d.capacity(), 8u);
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(d[i].text, std::to_string(7 - i));
+  d.emplace_back("x");
+  ASSERT_EQ(d.capacity(), 16u);
+  ASSERT_EQ(d.back().text, "x");
+  ASSERT_EQ(d.front().text, "7");
+}
+
+TEST(RingDeque, as_adaptor_container) {
+  s21::queue<int, s21::ring_deque<int>> q;
+  s21::stack<int, s21::ring_deque<int>> s;
+  for (int i = 0; i < 50; ++i) {
+    q.push(i);
+    s.push(i);
+  }
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_EQ(q.front(), i);
+    ASSERT_EQ(s.top(), 49 - i);
+    q.pop();
+    s.pop();
+  }
+  ASSERT_TRUE(q.empty());
+  ASSERT_TRUE(s.empty());
+}
@@ -0,0 +1,95 @@
+#include "test_headers.h"
+
+TEST(SegmentedVector, elements_never_move) {
+  s21::segmented_vector<int, 4> v;
+  v.push_back(0);
+  int* first = &v[0];
+  std::vector<int*> addresses;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(i + 1);
+    addresses.push_back(&v.back());
+  }
+  ASSERT_EQ(&v[0], first);
+  ASSERT_EQ(*first, 0);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(addresses[i], &v[i + 1]);
+    ASSERT_EQ(*addresses[i], i + 1);
+  }
+  ASSERT_EQ(v.size(), 1001u);
+  ASSERT_THROW(v.at(1001), std::out_of_range);
+}
+
+TEST(SegmentedVector, indexing_and_chunks) {
+  s21::segmented_vector<size_t, 2> v;
+  for (size_t i = 0; i < 100; ++i) v.push_back(i);
+  for (size_t i = 0; i < 100; ++i) ASSERT_EQ(v[i], i);
+  // Сегменты: 2, 4, 8, 16, 32, 64
+  ASSERT_EQ(v.capacity(), 126u);
+  ASSERT_EQ(v.chunk_count(), 6u);
+  size_t expected = 0;
+  for (size_t k = 0; k < v.chunk_count(); ++k) {
+    s21::span<size_t> chunk = v.chunk(k);
+    ASSERT_EQ(chunk.size(), k + 1 < v.chunk_count() ? size_t{2} << k : 38u);
+    for (size_t item : chunk) ASSERT_EQ(item, expected++);
+  }
+  ASSERT_EQ(expected, 100u);
+}
+
+TEST(SegmentedVector, iterators) {
+  s21::segmented_vector<int> v;
+  for (int i = 100; i > 0; --i) v.push_back(i);
+  std::sort(v.begin(), v.end());
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end()));
+  ASSERT_EQ(v.end() - v.begin(), 100);
+  ASSERT_EQ(v.begin()[40], 41);
+  const s21::segmented_vector<int>& view = v;
+  s21::segmented_vector<int>::const_iterator it = v.begin();
+  ASSERT_TRUE(it == view.begin());
+  ASSERT_EQ(std::accumulate(view.begin(), view.end(), 0), 5050);
+}
+
+TEST(SegmentedVector, iterators_survive_swap_and_move) {
+  s21::segmented_vector<int, 2> first, second{-1, -2};
+  for (int i = 0; i < 50; ++i) first.push_back(i);
+  s21::segmented_vector<int, 2>::iterator it = first.begin() + 10;
+  s21::segmented_vector<int, 2>::iterator end = first.end();
+  first.swap(second);
+  // Итератор указывает на тот же элемент, который теперь лежит в second
+  ASSERT_EQ(*it, 10);
+  ASSERT_TRUE(end == second.end());
+  it[30] = 100;
+  ASSERT_EQ(second[40], 100);
+  s21::segmented_vector<int, 2> moved(std::move(second));
+  ASSERT_EQ(*(it + 39), 49);
+  ASSERT_TRUE(end == moved.end());
+  second = std::move(moved);
+  int sum = 0;
+  for (auto i = it; i != end; ++i) sum += *i;
+  ASSERT_EQ(sum, (10 + 49) * 40 / 2 - 40 + 100);
+  ASSERT_EQ(first.size(), 2u);
+  ASSERT_EQ(*first.begin(), -1);
+}
+
+TEST(SegmentedVector, copy_move_resize) {
+  s21::segmented_vector<std::string> v = {"a", "b", "c"};
+  v.resize(40);
+  ASSERT_EQ(v.size(), 40u);
+  ASSERT_EQ(v[39], "");
+  v.back() = "z";
+  s21::segmented_vector<std::string> copy(v);
+  ASSERT_EQ(copy[0], "a");
+  ASSERT_EQ(copy.back(), "z");
+  std::string* address = &v[1];
+  s21::segmented_vector<std::string> moved(std::move(v));
+  ASSERT_EQ(&moved[1], address);
+  ASSERT_TRUE(v.empty());
+  moved.resize(2);
+  moved.shrink_to_fit();
+  ASSERT_EQ(moved.capacity(), 16u);
+  ASSERT_EQ(&moved[1], address);
+  copy = moved;
+  ASSERT_EQ(copy.size(), 2u);
+  ASSERT_EQ(copy[1], "b");
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+}
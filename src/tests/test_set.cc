@@ -177,3 +177,42 @@ TEST(SetTest, InsertMany) {
     ++it;
   }
 }
+
+TEST(SetTest, FindBatch) {
+  s21::set<int> mySet;
+  for (int i = 0; i < 500; i += 2) {
+    mySet.insert(i);
+  }
+  std::vector<int> keys = {498, 1, 0, 250, 251, 600, 250, -4};
+  std::vector<s21::set<int>::iterator> found(keys.size());
+  mySet.find_batch(keys.begin(), keys.end(), found.begin());
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(found[i].iter_is_nullptr(), !mySet.contains(keys[i]));
+    if (!found[i].iter_is_nullptr()) {
+      EXPECT_EQ(found[i].getKey(), keys[i]);
+    }
+  }
+  std::vector<bool> present;
+  mySet.contains_batch(keys.begin(), keys.end(), std::back_inserter(present));
+  EXPECT_EQ(present, (std::vector<bool>{true, false, true, true, false, false,
+                                        true, false}));
+}
+
+TEST(SetTest, SaveLoad) {
+  std::string path = testing::TempDir() + "s21_set_save_load.bin";
+  s21::set<int> mySet = {5, 1, 9, 3, 7, 2};
+  mySet.save(path);
+  s21::set<int> loaded;
+  loaded.load(path);
+  EXPECT_EQ(loaded.size(), mySet.size());
+  auto it = mySet.begin();
+  for (auto loaded_it = loaded.begin(); loaded_it != loaded.end();
+       ++loaded_it, ++it) {
+    EXPECT_EQ(loaded_it.getKey(), it.getKey());
+  }
+  s21::mapped_set<int> view(path);
+  EXPECT_EQ(view.size(), 6u);
+  EXPECT_TRUE(view.contains(7));
+  EXPECT_FALSE(view.contains(4));
+  std::remove(path.c_str());
+}
@@ -0,0 +1,136 @@
+#include "test_headers.h"
+
+namespace {
+// Уровни, которые можно проверить на этом процессоре
+std::vector<s21::simd::isa> supported_levels() {
+  std::vector<s21::simd::isa> result;
+  for (s21::simd::isa level :
+       {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2,
+        s21::simd::isa::avx512})
+    if (level <= s21::simd::detected_isa()) result.push_back(level);
+  return result;
+}
+
+template <class T>
+void check_kernels(const s21::vector<T>& values) {
+  for (s21::simd::isa level : supported_levels()) {
+    s21::simd::limit_isa(level);
+    ASSERT_EQ(s21::simd::active_isa(), level);
+    for (size_t n = 0; n <= values.size(); n += 7) {
+      const T* first = values.data();
+      const T* last = first + n;
+      for (T value : {T(3), T(97), T(-1)}) {
+        ASSERT_EQ(s21::simd::find(first, last, value),
+                  std::find(first, last, value));
+        ASSERT_EQ(s21::simd::count(first, last, value),
+                  static_cast<size_t>(std::count(first, last, value)));
+      }
+      if (n != 0) {
+        ASSERT_EQ(s21::simd::min(first, last), *std::min_element(first, last));
+        ASSERT_EQ(s21::simd::max(first, last), *std::max_element(first, last));
+      }
+    }
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
+}  // namespace
+
+TEST(Simd, int32_kernels) {
+  s21::vector<int32_t> values;
+  for (int i = 0; i < 300; ++i) values.push_back((i * 37 + 11) % 101 - 2);
+  values[250] = -1000;
+  values[123] = 5000;
+  check_kernels(values);
+  int64_t expected = std::accumulate(values.begin(), values.end(), int64_t{0});
+  for (s21::simd::isa level : supported_levels()) {
+    s21::simd::limit_isa(level);
+    ASSERT_EQ(s21::simd::sum(values), expected);
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
+
+TEST(Simd, float_kernels) {
+  s21::vector<float> values;
+  for (int i = 0; i < 300; ++i)
+    values.push_back(static_cast<float>((i * 53 + 7) % 103) - 2.0f);
+  values[7] = -0.5f;
+  check_kernels(values);
+  // Целые значения складываются точно при любом порядке
+  float expected = std::accumulate(values.begin(), values.end(), 0.0f);
+  for (s21::simd::isa level : supported_levels()) {
+    s21::simd::limit_isa(level);
+    ASSERT_FLOAT_EQ(s21::simd::sum(values), expected);
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
+
+TEST(Simd, containers) {
+  s21::array<int, 5> items = {4, -2, 9, 9, 0};
+  ASSERT_EQ(s21::simd::find(items, 9), items.begin() + 2);
+  ASSERT_EQ(s21::simd::count(items, 9), 2u);
+  ASSERT_EQ(s21::simd::min(items), -2);
+  ASSERT_EQ(s21::simd::max(items), 9);
+  ASSERT_EQ(s21::simd::sum(items), 20);
+  // Типы без ядер обрабатываются обычным циклом
+  s21::vector<double> doubles = {1.5, 2.5, -4.0};
+  ASSERT_DOUBLE_EQ(s21::simd::sum(doubles), 0.0);
+  ASSERT_DOUBLE_EQ(s21::simd::min(doubles), -4.0);
+  s21::vector<int> empty;
+  ASSERT_EQ(s21::simd::find(empty, 1), empty.data());
+  ASSERT_EQ(s21::simd::sum(empty), 0);
+  ASSERT_THROW(s21::simd::max(empty), std::invalid_argument);
+}
+
+namespace {
+// Проверяет перегрузки для контейнеров на всех доступных уровнях
+template <class Container>
+void check_container(Container& items) {
+  using T = s21::simd::element_t<Container>;
+  T* first = items.data();
+  T* last = first + items.size();
+  for (s21::simd::isa level : supported_levels()) {
+    s21::simd::limit_isa(level);
+    for (T value : {first[0], last[-1], T(-7)}) {
+      ASSERT_EQ(s21::simd::find(items, value), std::find(first, last, value));
+      ASSERT_EQ(s21::simd::count(items, value),
+                static_cast<size_t>(std::count(first, last, value)));
+    }
+    ASSERT_EQ(s21::simd::min(items), *std::min_element(first, last));
+    ASSERT_EQ(s21::simd::max(items), *std::max_element(first, last));
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
+}  // namespace
+
+TEST(Simd, array_and_vector_overloads) {
+  // Размеры не кратны ширине регистров, крайние значения лежат в хвосте
+  s21::array<int32_t, 203> ints;
+  for (size_t i = 0; i < ints.size(); ++i)
+    ints[i] = static_cast<int32_t>((i * 29 + 5) % 211) - 100;
+  ints[201] = 1000;
+  check_container(ints);
+  s21::array<float, 131> floats;
+  for (size_t i = 0; i < floats.size(); ++i)
+    floats[i] = static_cast<float>((i * 17 + 3) % 61) - 30.0f;
+  floats[130] = -500.0f;
+  check_container(floats);
+  s21::vector<int32_t> values;
+  for (int i = 0; i < 1000; ++i) values.push_back((i * 31 + 9) % 997 - 7);
+  values[995] = -5000;
+  check_container(values);
+  s21::vector<float> empty_floats;
+  ASSERT_EQ(s21::simd::count(empty_floats, 1.0f), 0u);
+}
+
+TEST(Simd, int32_sum_wraps) {
+  // Сумма int32_t переполняется по модулю 2^32 на всех уровнях одинаково
+  s21::vector<int32_t> values;
+  for (int i = 0; i < 77; ++i) values.push_back(INT32_MAX - i);
+  uint32_t wrapped = 0;
+  for (int32_t value : values) wrapped += static_cast<uint32_t>(value);
+  for (s21::simd::isa level : supported_levels()) {
+    s21::simd::limit_isa(level);
+    ASSERT_EQ(s21::simd::sum(values), static_cast<int32_t>(wrapped));
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx512);
+}
@@ -0,0 +1,140 @@
+#include <iterator>
+#include <sstream>
+
+#include "test_headers.h"
+
+TEST(SmallVector, stays_inline) {
+  s21::small_vector<int, 8> test;
+  for (int i = 0; i < 8; ++i) test.push_back(i);
+  ASSERT_TRUE(test.is_inline());
+  ASSERT_EQ(test.capacity(), 8u);
+  char* begin = reinterpret_cast<char*>(&test);
+  char* data = reinterpret_cast<char*>(test.data());
+  ASSERT_TRUE(data >= begin && data < begin + sizeof(test));
+  test.push_back(8);
+  ASSERT_FALSE(test.is_inline());
+  ASSERT_EQ(test.capacity(), 16u);
+  for (int i = 0; i < 9; ++i) ASSERT_EQ(test[i], i);
+}
+
+TEST(SmallVector, constructors) {
+  s21::small_vector<std::string, 2> empty;
+  ASSERT_TRUE(empty.empty());
+  s21::small_vector<std::string, 2> sized(5);
+  ASSERT_EQ(sized.size(), 5u);
+  ASSERT_EQ(sized[4], "");
+  s21::small_vector<std::string, 2> items{"a", "b", "c"};
+  s21::small_vector<std::string, 2> copy(items);
+  ASSERT_TRUE(copy == items);
+  ASSERT_EQ(copy.at(2), "c");
+  ASSERT_THROW(copy.at(3), std::out_of_range);
+  copy = sized;
+  ASSERT_EQ(copy.size(), 5u);
+}
+
+TEST(SmallVector, move_heap_steals_buffer) {
+  s21::small_vector<std::string, 2> test{"a", "b", "c"};
+  std::string* data = test.data();
+  s21::small_vector<std::string, 2> moved(std::move(test));
+  ASSERT_EQ(moved.data(), data);
+  ASSERT_TRUE(test.empty());
+  ASSERT_TRUE(test.is_inline());
+  s21::small_vector<std::string, 2> small{"x"};
+  moved = std::move(small);
+  ASSERT_EQ(moved.data(), data);
+  ASSERT_EQ(moved.size(), 1u);
+  ASSERT_EQ(moved[0], "x");
+  ASSERT_TRUE(small.empty());
+}
+
+TEST(SmallVector, insert_single_pass_range) {
+  s21::small_vector<std::string, 4> test{"a", "b"};
+  std::istringstream input("x y z w");
+  auto it = test.insert(test.begin() + 1,
+                        std::istream_iterator<std::string>(input),
+                        std::istream_iterator<std::string>());
+  ASSERT_EQ(it, test.begin() + 1);
+  ASSERT_FALSE(test.is_inline());
+  std::vector<std::string> result{"a", "x", "y", "z", "w", "b"};
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(SmallVector, insert_erase) {
+  s21::small_vector<std::string, 4> test;
+  std::vector<std::string> result;
+  for (int i = 0; i < 20; ++i) {
+    std::string value = std::to_string(i) + " long enough to leave SSO buffer";
+    test.insert(test.begin() + i / 2, value);
+    result.insert(result.begin() + i / 2, value);
+  }
+  test.insert(test.begin() + 3, 4, "four");
+  result.insert(result.begin() + 3, 4, "four");
+  test.insert(test.end(), result.begin(), result.begin() + 5);
+  result.insert(result.end(), result.begin(), result.begin() + 5);
+  test.erase(test.begin() + 2, test.begin() + 9);
+  result.erase(result.begin() + 2, result.begin() + 9);
+  test.erase(test.begin());
+  result.erase(result.begin());
+  test.emplace(test.begin() + 1, 3, 'z');
+  result.emplace(result.begin() + 1, 3, 'z');
+  test.pop_back();
+  result.pop_back();
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(SmallVector, shrink_to_fit_returns_inline) {
+  s21::small_vector<int, 4> test{1, 2, 3, 4, 5, 6};
+  ASSERT_FALSE(test.is_inline());
+  test.erase(test.begin() + 1, test.end() - 1);
+  test.shrink_to_fit();
+  ASSERT_TRUE(test.is_inline());
+  ASSERT_EQ(test.capacity(), 4u);
+  ASSERT_EQ(test.front(), 1);
+  ASSERT_EQ(test.back(), 6);
+  test.reserve(10);
+  ASSERT_EQ(test.capacity(), 10u);
+  ASSERT_EQ(test[1], 6);
+}
+
+TEST(SmallVector, swap_and_compare) {
+  s21::small_vector<int, 3> first{1, 2}, second{1, 2, 3, 4, 5};
+  ASSERT_TRUE(first < second);
+  ASSERT_TRUE(second >= first);
+  ASSERT_TRUE(first != second);
+  first.swap(second);
+  ASSERT_EQ(first.size(), 5u);
+  ASSERT_EQ(second.size(), 2u);
+  ASSERT_TRUE(second.is_inline());
+  ASSERT_EQ(first[4], 5);
+  ASSERT_TRUE(first > second);
+  first.clear();
+  ASSERT_TRUE(first.empty());
+  ASSERT_TRUE(first <= second);
+}
+
+TEST(SmallVector, throwing_copy_keeps_elements) {
+  s21::small_vector<std::string, 4> test{"a", "b", "c"};
+  struct Source {
+    bool fails;
+    operator std::string() const {
+      if (fails) throw std::runtime_error("conversion failed");
+      return "x";
+    }
+  };
+  // Последний элемент вставки бросает: и внутри буфера, и при переезде в
+  // кучу вектор остается прежним
+  for (size_t count : {0u, 5u}) {
+    s21::small_vector<Source, 8> sources;
+    for (size_t i = 0; i < count; ++i) sources.push_back(Source{false});
+    sources.push_back(Source{true});
+    ASSERT_THROW(test.insert(test.begin() + 1, sources.begin(), sources.end()),
+                 std::runtime_error);
+    ASSERT_EQ(test.size(), 3u);
+    ASSERT_TRUE(test.is_inline());
+    ASSERT_EQ(test[0], "a");
+    ASSERT_EQ(test[1], "b");
+    ASSERT_EQ(test[2], "c");
+  }
+}
@@ -0,0 +1,51 @@
+#include "test_headers.h"
+
+TEST(SoaVector, rows_and_columns) {
+  s21::soa_vector<int, double, std::string> table;
+  for (int i = 0; i < 100; ++i)
+    table.push_back(i, i * 0.25, "row " + std::to_string(i));
+  ASSERT_EQ(table.size(), 100u);
+  ASSERT_EQ(table.capacity(), 128u);
+  s21::span<double> weights = table.column<1>();
+  double total = 0;
+  for (double weight : weights) total += weight;
+  ASSERT_DOUBLE_EQ(total, 99 * 100 / 8.0);
+  ASSERT_EQ(table.column<0>()[42], 42);
+  ASSERT_EQ(table[7].get<2>(), "row 7");
+  table[7].get<0>() = -7;
+  ASSERT_EQ(table.column<0>()[7], -7);
+  std::tuple<int, double, std::string> row = table[3];
+  ASSERT_EQ(std::get<2>(row), "row 3");
+  table[4] = table[3];
+  ASSERT_EQ(table.at(4).get<0>(), 3);
+  ASSERT_THROW(table.at(100), std::out_of_range);
+}
+
+TEST(SoaVector, modifiers) {
+  s21::soa_vector<int, char> table{{1, 'a'}, {2, 'b'}};
+  table.emplace_back(3, 'c').get<1>() = 'C';
+  table.push_back(std::make_tuple(4, 'd'));
+  ASSERT_EQ(table.size(), 4u);
+  ASSERT_EQ(table.column<1>()[2], 'C');
+  table.pop_back();
+  int sum = 0;
+  for (auto row : table) sum += row.get<0>();
+  ASSERT_EQ(sum, 6);
+  table.resize(6);
+  ASSERT_EQ(table.column<0>()[5], 0);
+  table.reserve(50);
+  ASSERT_EQ(table.capacity(), 50u);
+  table.shrink_to_fit();
+  ASSERT_EQ(table.capacity(), 6u);
+  s21::soa_vector<int, char> other;
+  other.swap(table);
+  ASSERT_TRUE(table.empty());
+  ASSERT_EQ(other.size(), 6u);
+  const s21::soa_vector<int, char>& view = other;
+  s21::span<const char> letters = view.column<1>();
+  ASSERT_EQ(letters.front(), 'a');
+  ASSERT_EQ(letters.subspan(1, 2).back(), 'C');
+  ASSERT_EQ(std::get<1>(view[1]), 'b');
+  other.clear();
+  ASSERT_TRUE(other.empty());
+}
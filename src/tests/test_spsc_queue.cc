@@ -0,0 +1,63 @@
+#include <thread>
+
+#include "test_headers.h"
+
+TEST(SpscQueue, single_thread) {
+  s21::spsc_queue<std::string, 4> q;
+  ASSERT_TRUE(q.empty());
+  ASSERT_EQ(q.capacity(), 4u);
+  for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(std::to_string(i)));
+  ASSERT_FALSE(q.try_push("full"));
+  ASSERT_EQ(q.size(), 4u);
+  std::string out;
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(out, "0");
+  ASSERT_TRUE(q.try_emplace(3, 'x'));
+  std::string batch[8];
+  ASSERT_EQ(q.pop_n(batch, 8), 4u);
+  ASSERT_EQ(batch[0], "1");
+  ASSERT_EQ(batch[3], "xxx");
+  ASSERT_FALSE(q.try_pop(out));
+  // Пачка переходит через конец буфера и обрезается по свободному месту
+  const std::string items[] = {"a", "b", "c", "d", "e"};
+  ASSERT_EQ(q.push_n(items, 5), 4u);
+  ASSERT_EQ(q.pop_n(batch, 2), 2u);
+  ASSERT_EQ(batch[1], "b");
+  ASSERT_EQ(q.size(), 2u);
+}
+
+TEST(SpscQueue, two_threads_keep_order) {
+  constexpr size_t kCount = 1000000;
+  s21::spsc_queue<size_t, 1024> q;
+  std::thread producer([&q]() {
+    size_t batch[37];
+    size_t next = 0;
+    while (next < kCount) {
+      if (next % 2 == 0) {
+        size_t n = std::min<size_t>(37, kCount - next);
+        for (size_t i = 0; i < n; ++i) batch[i] = next + i;
+        size_t pushed = q.push_n(batch, n);
+        next += pushed;
+        if (pushed == 0) std::this_thread::yield();
+      } else if (q.try_push(next)) {
+        ++next;
+      }
+    }
+  });
+  size_t expected = 0;
+  bool ordered = true;
+  size_t batch[64];
+  while (expected < kCount) {
+    size_t popped = 0;
+    if (expected % 3 == 0) {
+      popped = q.pop_n(batch, 64);
+    } else if (q.try_pop(batch[0])) {
+      popped = 1;
+    }
+    for (size_t i = 0; i < popped; ++i) ordered &= batch[i] == expected++;
+    if (popped == 0) std::this_thread::yield();
+  }
+  producer.join();
+  ASSERT_TRUE(ordered);
+  ASSERT_TRUE(q.empty());
+}
@@ -1,4 +1,7 @@
+#include <iterator>
+#include <sstream>
 
+#include "../Sequence_Container/vector_dir/huge_page_allocator.h"
 #include "test_headers.h"
 
 TEST(Default_constructor, test_int) {
@@ -86,6 +89,32 @@ TEST(Copy_assignment_operator, test_params) {
   for (size_t i = 0; i < test.size(); ++i) ASSERT_DOUBLE_EQ(test[i], result[i]);
 }
 
+TEST(Copy_assignment_operator, reuses_capacity) {
+  s21::vector<std::string> source = {"a", "b", "c"};
+  s21::vector<std::string> test;
+  test.reserve(10);
+  test.push_back("x");
+  std::string* data = test.data();
+  test = source;
+  ASSERT_EQ(test.data(), data);
+  ASSERT_EQ(test.capacity(), 10u);
+  ASSERT_TRUE(test == source);
+  s21::vector<std::string> shorter = {"z"};
+  test = shorter;
+  ASSERT_EQ(test.data(), data);
+  ASSERT_EQ(test.size(), 1u);
+  ASSERT_EQ(test[0], "z");
+  // При нехватке места выделяется size(), а не емкость источника
+  s21::vector<std::string> longer;
+  longer.reserve(100);
+  for (int i = 0; i < 23; ++i) longer.push_back(std::to_string(i));
+  test = longer;
+  ASSERT_EQ(test.capacity(), 23u);
+  ASSERT_TRUE(test == longer);
+  test = test;
+  ASSERT_EQ(test.size(), 23u);
+}
+
 TEST(Move_assignment_operator, test_params) {
   std::initializer_list<double> params = {1.2, 3.4, 5.678};
   s21::vector<double> temp1{params}, test;
@@ -276,3 +305,590 @@ TEST(Comparison_operators, test_params) {
   ASSERT_EQ(test1 < test2, result1 < result2);
   ASSERT_EQ(test2 <= test1, result2 <= result1);
 }
+
+namespace {
+// Тип, который считает свои конструкторы и деструкторы
+struct Counted {
+  static int alive, copies, moves;
+  int value;
+  Counted() : value(0) { ++alive; }
+  Counted(int v) : value(v) { ++alive; }
+  Counted(const Counted& other) : value(other.value) {
+    ++alive;
+    ++copies;
+  }
+  Counted(Counted&& other) noexcept : value(other.value) {
+    ++alive;
+    ++moves;
+  }
+  Counted& operator=(const Counted& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  Counted& operator=(Counted&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+  ~Counted() { --alive; }
+  static void Reset() { alive = copies = moves = 0; }
+};
+int Counted::alive = 0;
+int Counted::copies = 0;
+int Counted::moves = 0;
+}  // namespace
+
+TEST(Reserve_method, constructs_only_live_elements) {
+  Counted::Reset();
+  {
+    s21::vector<Counted> test;
+    test.reserve(100);
+    ASSERT_EQ(Counted::alive, 0);
+    test.push_back(Counted(1));
+    test.push_back(Counted(2));
+    ASSERT_EQ(Counted::alive, 2);
+    test.pop_back();
+    ASSERT_EQ(Counted::alive, 1);
+    test.clear();
+    ASSERT_EQ(Counted::alive, 0);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(Reserve_method, moves_elements_on_growth) {
+  Counted::Reset();
+  {
+    s21::vector<Counted> test;
+    for (int i = 0; i < 100; ++i) test.push_back(Counted(i));
+    int copies = Counted::copies;
+    test.reserve(1000);
+    test.shrink_to_fit();
+    ASSERT_EQ(Counted::copies, copies);
+    for (int i = 0; i < 100; ++i) ASSERT_EQ(test[i].value, i);
+    test.insert(test.begin() + 50, Counted(-1));
+    test.erase(test.begin());
+    ASSERT_EQ(test.size(), 100u);
+    ASSERT_EQ(test[49].value, -1);
+    ASSERT_EQ(Counted::alive, 100);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(Push_back_method, test_strings) {
+  s21::vector<std::string> test;
+  std::vector<std::string> result;
+  for (int i = 0; i < 1000; ++i) {
+    test.push_back(std::to_string(i) + std::string(20, 'x'));
+    result.push_back(std::to_string(i) + std::string(20, 'x'));
+  }
+  test.push_back(test[0]);
+  result.push_back(result[0]);
+  test.insert(test.begin(), test[5]);
+  result.insert(result.begin(), result[5]);
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(Emplace_back_method, test_params) {
+  s21::vector<std::pair<int, std::string>> test;
+  std::vector<std::pair<int, std::string>> result;
+  for (int i = 0; i < 20; ++i) {
+    auto& back = test.emplace_back(i, std::string(i, 'a'));
+    result.emplace_back(i, std::string(i, 'a'));
+    ASSERT_EQ(&back, &test[test.size() - 1]);
+  }
+  ASSERT_EQ(test.size(), result.size());
+  ASSERT_EQ(test.capacity(), result.capacity());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(Emplace_back_method, move_only_type) {
+  s21::vector<std::unique_ptr<int>> test;
+  for (int i = 0; i < 10; ++i) test.emplace_back(new int(i));
+  test.push_back(std::make_unique<int>(10));
+  ASSERT_EQ(test.size(), 11u);
+  for (int i = 0; i < 11; ++i) ASSERT_EQ(*test[i], i);
+}
+
+TEST(Push_back_method, rvalue_does_not_copy) {
+  Counted::Reset();
+  {
+    s21::vector<Counted> test;
+    for (int i = 0; i < 100; ++i) test.push_back(Counted(i));
+    Counted value(100);
+    test.push_back(std::move(value));
+    test.emplace_back(101);
+    ASSERT_EQ(Counted::copies, 0);
+    ASSERT_EQ(test.size(), 102u);
+    ASSERT_EQ(test[101].value, 101);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(Emplace_method, test_params) {
+  s21::vector<std::string> test{"a", "b", "c"};
+  std::vector<std::string> result{"a", "b", "c"};
+  test.reserve(10);
+  result.reserve(10);
+  auto it = test.emplace(test.begin() + 1, 3, 'x');
+  result.emplace(result.begin() + 1, 3, 'x');
+  ASSERT_EQ(*it, "xxx");
+  test.emplace(test.end(), "end");
+  result.emplace(result.end(), "end");
+  test.shrink_to_fit();
+  result.shrink_to_fit();
+  test.emplace(test.begin(), test[2]);
+  result.emplace(result.begin(), result[2]);
+  test.emplace(test.begin() + 2, test.back());
+  result.emplace(result.begin() + 2, result.back());
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(Insert_method, range_and_fill) {
+  s21::vector<int> test{1, 2, 3, 4, 5};
+  std::vector<int> result{1, 2, 3, 4, 5};
+  int extra[] = {10, 11, 12};
+  auto it = test.insert(test.begin() + 2, extra, extra + 3);
+  result.insert(result.begin() + 2, extra, extra + 3);
+  ASSERT_EQ(*it, 10);
+  test.reserve(100);
+  result.reserve(100);
+  it = test.insert(test.begin() + 1, 4, 7);
+  result.insert(result.begin() + 1, 4, 7);
+  ASSERT_EQ(it, test.begin() + 1);
+  std::list<int> source{20, 21};
+  test.insert(test.end(), source.begin(), source.end());
+  result.insert(result.end(), source.begin(), source.end());
+  test.insert(test.begin(), 0, 99);
+  result.insert(result.begin(), 0, 99);
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(Insert_method, single_pass_range) {
+  s21::vector<int> test{1, 2, 3};
+  std::istringstream input("10 11 12 13 14 15 16 17 18");
+  auto it = test.insert(test.begin() + 1, std::istream_iterator<int>(input),
+                        std::istream_iterator<int>());
+  ASSERT_EQ(it, test.begin() + 1);
+  std::vector<int> result{1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 2, 3};
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+  std::istringstream empty_input("");
+  it = test.insert(test.begin(), std::istream_iterator<int>(empty_input),
+                   std::istream_iterator<int>());
+  ASSERT_EQ(it, test.begin());
+  ASSERT_EQ(test.size(), result.size());
+}
+
+TEST(Insert_method, range_of_strings) {
+  s21::vector<std::string> test{"a", "b", "c", "d"};
+  std::vector<std::string> result{"a", "b", "c", "d"};
+  std::string extra[] = {"x", "y", "z", "w", "v", "u"};
+  test.reserve(20);
+  result.reserve(20);
+  for (size_t n : {1u, 3u, 6u}) {
+    test.insert(test.begin() + 1, extra, extra + n);
+    result.insert(result.begin() + 1, extra, extra + n);
+    test.insert(test.end() - 2, n, test[0]);
+    result.insert(result.end() - 2, n, result[0]);
+  }
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+}
+
+TEST(Erase_method, range) {
+  s21::vector<std::string> test;
+  std::vector<std::string> result;
+  for (int i = 0; i < 50; ++i) {
+    test.push_back(std::to_string(i));
+    result.push_back(std::to_string(i));
+  }
+  test.erase(test.begin() + 10, test.begin() + 30);
+  result.erase(result.begin() + 10, result.begin() + 30);
+  test.erase(test.begin(), test.begin());
+  result.erase(result.begin(), result.begin());
+  test.erase(test.end() - 5, test.end());
+  result.erase(result.end() - 5, result.end());
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+  s21::vector<int> numbers{1, 2, 3, 4, 5, 6};
+  numbers.erase(numbers.begin() + 1, numbers.begin() + 4);
+  ASSERT_EQ(numbers.size(), 3u);
+  ASSERT_EQ(numbers[0], 1);
+  ASSERT_EQ(numbers[1], 5);
+  ASSERT_EQ(numbers[2], 6);
+}
+
+TEST(Comparison_operators, lexicographic_without_overflow) {
+  int low = std::numeric_limits<int>::min();
+  int high = std::numeric_limits<int>::max();
+  s21::vector<int> test1{low, 1}, test2{high};
+  std::vector<int> result1{low, 1}, result2{high};
+  ASSERT_EQ(test1 < test2, result1 < result2);
+  ASSERT_EQ(test2 > test1, result2 > result1);
+  s21::vector<int> shorter{1, 2}, longer{1, 2, 0};
+  ASSERT_TRUE(shorter < longer);
+  ASSERT_TRUE(longer >= shorter);
+}
+
+TEST(Comparison_operators, long_vectors) {
+  for (size_t pos : {0u, 15u, 16u, 31u, 32u, 77u, 199u}) {
+    s21::vector<unsigned> test1, test2;
+    std::vector<unsigned> result1, result2;
+    for (unsigned i = 0; i < 200; ++i) {
+      unsigned value = i * 2654435761u;
+      test1.push_back(value);
+      result1.push_back(value);
+      test2.push_back(i == pos ? value - 1 : value);
+      result2.push_back(i == pos ? value - 1 : value);
+    }
+    ASSERT_EQ(test1 == test2, result1 == result2);
+    ASSERT_EQ(test1 < test2, result1 < result2);
+    ASSERT_EQ(test1 > test2, result1 > result2);
+    ASSERT_TRUE(test1 == test1);
+  }
+}
+
+TEST(Comparison_operators, floating_point) {
+  s21::vector<double> test1{0.0, 1.5}, test2{-0.0, 1.5}, test3{0.0, 2.5};
+  ASSERT_TRUE(test1 == test2);
+  ASSERT_TRUE(test1 < test3);
+  s21::vector<std::string> words1{"abc", "b"}, words2{"abc", "ab"};
+  ASSERT_TRUE(words2 < words1);
+}
+
+namespace {
+// Равенство и порядок смотрят только на id, поле note не сравнивается
+struct Record {
+  int id;
+  int note;
+  bool operator==(const Record& other) const { return id == other.id; }
+  bool operator<(const Record& other) const { return id < other.id; }
+};
+}  // namespace
+
+TEST(Comparison_operators, uses_element_operators) {
+  s21::vector<Record> test1{{1, 5}, {2, 0}}, test2{{1, 7}, {2, 9}};
+  ASSERT_TRUE(test1 == test2);
+  ASSERT_FALSE(test1 != test2);
+  ASSERT_FALSE(test1 < test2);
+  ASSERT_FALSE(test2 < test1);
+  ASSERT_TRUE(test1 <= test2 && test1 >= test2);
+  // Байты {256} меньше байтов {1} при сравнении памяти, но id больше
+  s21::vector<Record> test3{{1, 0}, {256, 0}}, test4{{1, 0}, {1, 0}};
+  ASSERT_TRUE(test4 < test3);
+  ASSERT_TRUE(test3 > test4);
+}
+
+TEST(Clear_method, destroys_elements) {
+  Counted::Reset();
+  {
+    s21::vector<Counted> test;
+    for (int i = 0; i < 10; ++i) test.emplace_back(i);
+    test.pop_back();
+    ASSERT_EQ(Counted::alive, 9);
+    test.erase(test.begin(), test.begin() + 3);
+    ASSERT_EQ(Counted::alive, 6);
+    test.clear();
+    ASSERT_EQ(Counted::alive, 0);
+    ASSERT_EQ(test.size(), 0u);
+    ASSERT_EQ(test.capacity(), 16u);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(Clear_method, trivial_keeps_storage) {
+  s21::vector<int> test{1, 2, 3, 4};
+  int* data = test.data();
+  test.pop_back();
+  test.clear();
+  ASSERT_TRUE(test.empty());
+  ASSERT_EQ(test.data(), data);
+  ASSERT_EQ(test.capacity(), 4u);
+  test.push_back(7);
+  ASSERT_EQ(test[0], 7);
+}
+
+namespace {
+// Аллокатор с номером арены, который не переносится при перемещении
+template <class T>
+struct ArenaAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+  int arena;
+  explicit ArenaAllocator(int arena = 0) : arena(arena) {}
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+  T* allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+  ArenaAllocator select_on_container_copy_construction() const {
+    return ArenaAllocator(-1);
+  }
+  bool operator==(const ArenaAllocator& other) const {
+    return arena == other.arena;
+  }
+  bool operator!=(const ArenaAllocator& other) const {
+    return arena != other.arena;
+  }
+};
+}  // namespace
+
+TEST(Allocator, pmr_monotonic_buffer) {
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  s21::pmr::vector<int> test(&resource);
+  for (int i = 0; i < 100; ++i) test.push_back(i);
+  char* data = reinterpret_cast<char*>(test.data());
+  ASSERT_TRUE(data >= buffer && data < buffer + sizeof(buffer));
+  ASSERT_EQ(test.get_allocator().resource(), &resource);
+  ASSERT_EQ(test[99], 99);
+  s21::pmr::vector<std::pmr::string> words(&resource);
+  words.emplace_back("a string that does not fit into the small buffer");
+  ASSERT_EQ(words[0].get_allocator().resource(), &resource);
+}
+
+TEST(Allocator, exhausted_resource_throws) {
+  alignas(std::max_align_t) char buffer[256];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  s21::pmr::vector<int> test(&resource);
+  test.reserve(16);
+  for (int i = 0; i < 16; ++i) test.push_back(i);
+  // Исключение аллокатора доходит до вызывающего, вектор не меняется
+  ASSERT_THROW(test.reserve(1000), std::bad_alloc);
+  ASSERT_THROW(test.insert(test.begin() + 3, 1000, 7), std::bad_alloc);
+  ASSERT_THROW(test.resize(1000), std::bad_alloc);
+  ASSERT_EQ(test.size(), 16u);
+  ASSERT_EQ(test.capacity(), 16u);
+  for (int i = 0; i < 16; ++i) ASSERT_EQ(test[i], i);
+  ASSERT_THROW(s21::pmr::vector<int>(1000, &resource), std::bad_alloc);
+}
+
+namespace {
+// Элемент, копия которого бросает исключение после copies_left копий
+struct FragileItem {
+  static int copies_left;
+  static int alive;
+  int value;
+  FragileItem(int v = 0) : value(v) { ++alive; }
+  FragileItem(const FragileItem& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++alive;
+  }
+  FragileItem(FragileItem&& other) noexcept : value(other.value) { ++alive; }
+  FragileItem& operator=(const FragileItem&) = default;
+  FragileItem& operator=(FragileItem&&) = default;
+  ~FragileItem() { --alive; }
+};
+int FragileItem::copies_left = -1;
+int FragileItem::alive = 0;
+}  // namespace
+
+TEST(Allocator, throwing_element_copy_is_contained) {
+  FragileItem::alive = 0;
+  {
+    s21::vector<FragileItem> test;
+    test.reserve(20);
+    for (int i = 0; i < 10; ++i) test.emplace_back(i);
+    auto check = [&test]() {
+      ASSERT_EQ(test.size(), 10u);
+      for (int i = 0; i < 10; ++i) ASSERT_EQ(test[i].value, i);
+      ASSERT_EQ(FragileItem::alive, 10);
+    };
+    // Вставка в середину без перевыделения: дыра закрывается обратно
+    FragileItem::copies_left = 3;
+    ASSERT_THROW(test.insert(test.begin() + 4, 5, FragileItem(-1)),
+                 std::runtime_error);
+    check();
+    // Вставка с переездом: старый буфер остается на месте
+    FragileItem::copies_left = 8;
+    ASSERT_THROW(test.insert(test.begin() + 2, 15, FragileItem(-1)),
+                 std::runtime_error);
+    check();
+    FragileItem::copies_left = 2;
+    ASSERT_THROW(test.resize(30, FragileItem(-1)), std::runtime_error);
+    check();
+    // Недостроенная копия вектора разрушает то, что успела создать
+    FragileItem::copies_left = 6;
+    ASSERT_THROW(s21::vector<FragileItem> copy(test), std::runtime_error);
+    check();
+    s21::vector<FragileItem> small{FragileItem(1)};
+    FragileItem::copies_left = 4;
+    ASSERT_THROW(small = test, std::runtime_error);
+    ASSERT_TRUE(small.empty());
+    FragileItem::copies_left = -1;
+    small = test;
+    ASSERT_EQ(small.size(), 10u);
+  }
+  ASSERT_EQ(FragileItem::alive, 0);
+}
+
+TEST(Allocator, propagation) {
+  using arena_vector = s21::vector<std::string, ArenaAllocator<std::string>>;
+  arena_vector first({"a", "b", "c"}, ArenaAllocator<std::string>(1));
+  arena_vector copy(first);
+  ASSERT_EQ(copy.get_allocator().arena, -1);
+  ASSERT_TRUE(copy == first);
+  arena_vector second(ArenaAllocator<std::string>(2));
+  second = std::move(first);
+  ASSERT_EQ(second.get_allocator().arena, 2);
+  ASSERT_EQ(second.size(), 3u);
+  ASSERT_EQ(second[2], "c");
+  ASSERT_TRUE(first.empty());
+  second.swap(copy);
+  ASSERT_EQ(second.get_allocator().arena, -1);
+  ASSERT_EQ(copy.get_allocator().arena, 2);
+  ASSERT_EQ(copy[0], "a");
+}
+
+TEST(Growth_policy, capacities) {
+  s21::vector<int, std::allocator<int>, s21::growth_one_and_half> half;
+  s21::vector<int, std::allocator<int>, s21::growth_chunk<10>> chunk;
+  s21::vector<int, std::allocator<int>, s21::growth_page<4096>> page;
+  for (int i = 0; i < 5; ++i) {
+    half.push_back(i);
+    chunk.push_back(i);
+    page.push_back(i);
+  }
+  ASSERT_EQ(half.capacity(), 6u);
+  ASSERT_EQ(chunk.capacity(), 10u);
+  ASSERT_EQ(page.capacity(), 1024u);
+  half.insert(half.end(), 10, 7);
+  ASSERT_EQ(half.capacity(), 15u);
+  chunk.insert(chunk.end(), 10, 7);
+  ASSERT_EQ(chunk.capacity(), 20u);
+  ASSERT_EQ(chunk[14], 7);
+}
+
+TEST(Growth_policy, tracked_counters) {
+  s21::vector<int, std::allocator<int>, s21::growth_tracked<>> test;
+  for (int i = 0; i < 100; ++i) test.push_back(i);
+  const auto& stats = test.growth_policy();
+  ASSERT_EQ(stats.reallocations(), 8u);
+  ASSERT_EQ(stats.peak_capacity(), 128u);
+  ASSERT_EQ(stats.bytes_copied(), 127 * sizeof(int));
+  test.shrink_to_fit();
+  ASSERT_EQ(stats.reallocations(), 9u);
+  ASSERT_EQ(stats.peak_capacity(), 128u);
+  ASSERT_EQ(test.capacity(), 100u);
+  s21::pmr::vector<int, s21::growth_tracked<s21::growth_chunk<16>>> arena;
+  arena.reserve(4);
+  arena.emplace_back(1);
+  ASSERT_EQ(arena.growth_policy().reallocations(), 1u);
+  ASSERT_EQ(arena.growth_policy().bytes_copied(), 0u);
+}
+
+TEST(Growth_policy, tracked_construction_and_assignment) {
+  using tracked_vector =
+      s21::vector<int, std::allocator<int>, s21::growth_tracked<>>;
+  tracked_vector sized(100);
+  ASSERT_EQ(sized.growth_policy().peak_capacity(), 100u);
+  ASSERT_EQ(sized.growth_policy().reallocations(), 1u);
+  tracked_vector listed{1, 2, 3};
+  ASSERT_EQ(listed.growth_policy().peak_capacity(), 3u);
+  tracked_vector copy(sized);
+  ASSERT_EQ(copy.growth_policy().peak_capacity(), 100u);
+  ASSERT_EQ(copy.growth_policy().bytes_copied(), 0u);
+  // Копирующее присваивание в короткий вектор выделяет ровно size(), но
+  // переезд учитывается политикой
+  listed = sized;
+  ASSERT_EQ(listed.capacity(), 100u);
+  ASSERT_EQ(listed.growth_policy().peak_capacity(), 100u);
+  ASSERT_EQ(listed.growth_policy().reallocations(), 2u);
+  ASSERT_EQ(listed.growth_policy().bytes_copied(), 0u);
+  // Если места хватает, буфер не меняется
+  listed = copy;
+  ASSERT_EQ(listed.growth_policy().reallocations(), 2u);
+  s21::vector<int, std::allocator<int>, s21::growth_tracked<>> small{1},
+      triple(3);
+  small = triple;
+  ASSERT_EQ(small.capacity(), 3u);
+  ASSERT_EQ(small.growth_policy().peak_capacity(), 3u);
+  ASSERT_EQ(small.growth_policy().reallocations(), 2u);
+}
+
+TEST(Huge_page_allocator, grows_without_copying) {
+  using huge_vector = s21::vector<uint64_t, s21::huge_page_allocator<uint64_t>,
+                                  s21::growth_tracked<>>;
+  huge_vector test;
+  const uint64_t count = 1 << 20;
+  for (uint64_t i = 0; i < count; ++i) test.push_back(i * 3);
+  ASSERT_EQ(test.size(), count);
+  ASSERT_EQ(test.growth_policy().bytes_copied(), 0u);
+  ASSERT_EQ(test.growth_policy().reallocations(), 21u);
+  for (uint64_t i = 0; i < count; i += 4099) ASSERT_EQ(test[i], i * 3);
+  test.reserve(count * 4);
+  test.push_back(test[5]);
+  ASSERT_EQ(test.back(), 15u);
+  test.insert(test.begin() + 1, 3, 7);
+  ASSERT_EQ(test[0], 0u);
+  ASSERT_EQ(test[3], 7u);
+  ASSERT_EQ(test[4], 3u);
+  test.shrink_to_fit();
+  ASSERT_EQ(test.capacity(), count + 4);
+  ASSERT_EQ(test[count + 3], 15u);
+  huge_vector copy(test);
+  ASSERT_TRUE(copy == test);
+}
+
+TEST(Huge_page_allocator, reallocate_keeps_alignment) {
+  using allocator = s21::huge_page_allocator<uint64_t>;
+  allocator alloc;
+  auto is_aligned = [](const uint64_t* p) {
+    return reinterpret_cast<uintptr_t>(p) % allocator::kHugePageSize == 0;
+  };
+  // Маленький блок выровнен только по обычной странице
+  size_t n = 1000;
+  uint64_t* p = alloc.allocate(n);
+  for (size_t i = 0; i < n; ++i) p[i] = i;
+  for (size_t new_n : {size_t{1} << 19, size_t{3} << 19, size_t{5} << 20}) {
+    p = alloc.reallocate(p, n, new_n);
+    ASSERT_TRUE(is_aligned(p));
+    for (size_t i = 0; i < n; i += 97) ASSERT_EQ(p[i], i);
+    for (size_t i = n; i < new_n; ++i) p[i] = i;
+    n = new_n;
+  }
+  p = alloc.reallocate(p, n, size_t{1} << 19);
+  ASSERT_TRUE(is_aligned(p));
+  ASSERT_EQ(p[(size_t{1} << 19) - 1], (size_t{1} << 19) - 1);
+  alloc.deallocate(p, size_t{1} << 19);
+}
+
+TEST(Resize_method, test_params) {
+  s21::vector<std::string> test{"a", "b", "c"};
+  std::vector<std::string> result{"a", "b", "c"};
+  test.resize(6);
+  result.resize(6);
+  test.resize(9, test[1]);
+  result.resize(9, result[1]);
+  ASSERT_EQ(test.size(), result.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(test[i], result[i]);
+  test.resize(2);
+  ASSERT_EQ(test.size(), 2u);
+  ASSERT_EQ(test.back(), "b");
+  s21::vector<int> numbers(3);
+  numbers.resize(40);
+  for (int value : numbers) ASSERT_EQ(value, 0);
+}
+
+TEST(Resize_method, default_init) {
+  s21::vector<char> buffer;
+  buffer.resize_default_init(16);
+  ASSERT_EQ(buffer.size(), 16u);
+  std::memcpy(buffer.data(), "fill me directly", 16);
+  ASSERT_EQ(buffer[5], 'm');
+  Counted::Reset();
+  {
+    s21::vector<Counted> test(2);
+    test.resize_default_init(5);
+    ASSERT_EQ(Counted::alive, 5);
+    test.resize(1);
+    ASSERT_EQ(Counted::alive, 1);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}